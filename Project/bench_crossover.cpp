@@ -0,0 +1,165 @@
+//=============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <forward_list>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include "beyond_project.hpp"
+
+//=============================================================================
+
+//
+// Measures beyond_project::crossover() throughput (in MB of child produced
+// per second) for individuals of 1 KB to 1 MB with a few crossover points,
+// writing to:
+//   * a std::back_inserter into a reserved std::string,
+//   * a pointer into a preallocated buffer, and,
+//   * a std::back_inserter with std::forward_list and std::list parents.
+// Each is measured before (baseline_crossover(), the original segment loop)
+// and after (crossover()) with the same inputs and random numbers.
+//
+// NOTE: Build with optimizations and without sanitizers for meaningful
+//       numbers, e.g., make bench CXXFLAGS="-std=c++20 -O3 -march=native".
+//
+
+// The original crossover() loop: each segment is copied with
+// std::ranges::copy_n() and then both parents' iterators are advanced past
+// it (i.e., the copied parent is walked twice)...
+template <
+  typename URBG1,
+  typename URBG2,
+  std::ranges::forward_range Parent1,
+  std::ranges::forward_range Parent2,
+  typename OutIndividual
+>
+OutIndividual baseline_crossover(
+  std::size_t const ncrossover_points,
+  URBG1&& urbg_starting_parent,
+  URBG2&& urbg_crossover_points,
+  Parent1 const& parent1,
+  Parent2 const& parent2,
+  OutIndividual out
+)
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::beyond_project;
+  size_t const sz = min_range_size(parent1, parent2);
+
+  auto p1it = ranges::cbegin(parent1);
+  auto p2it = ranges::cbegin(parent2);
+
+  bernoulli_distribution bd(0.5);
+  bool which_parent = bd(urbg_starting_parent);
+
+  region_sample_iterator i{urbg_crossover_points, sz, ncrossover_points+1};
+  region_sample_iterator<remove_cvref_t<URBG2>> i_end{};
+
+  for (; i != i_end; ++i)
+  {
+    auto const sz = i->to - i->from;
+
+    if (which_parent)
+      out = ranges::copy_n(p1it, sz, out).out;
+    else
+      out = ranges::copy_n(p2it, sz, out).out;
+
+    which_parent = !which_parent;
+    advance(p1it, sz);
+    advance(p2it, sz);
+  }
+
+  if (!which_parent)
+    out = ranges::copy(p1it, ranges::cend(parent1), out).out;
+  else
+    out = ranges::copy(p2it, ranges::cend(parent2), out).out;
+  return out;
+}
+
+// Keeps the work being timed from being optimized away...
+std::size_t volatile sink;
+
+template <typename Parent1, typename Parent2, typename Run>
+double megabytes_per_second(Parent1 const& p1, Parent2 const& p2,
+  std::size_t const size, Run run)
+{
+  using namespace std;
+  using clock = chrono::steady_clock;
+
+  default_random_engine which_parent_re{1}, points_re{2};
+  size_t const reps = std::max<size_t>((64U << 20) / size, 4);
+  size_t checksum{};
+  auto const start = clock::now();
+  for (size_t r{}; r != reps; ++r)
+    checksum += run(p1, p2, which_parent_re, points_re);
+  double const seconds =
+    chrono::duration<double>(clock::now() - start).count();
+  sink = checksum;
+  return reps * size / seconds / 1e6;
+}
+
+int main()
+{
+  using namespace std;
+  using uwindsor_2023w::comp3400::beyond_project::crossover;
+
+  size_t const npoints = 4;
+  cout
+    << "size\tstring->inserter\tstring->pointer\t\tlist->inserter\n"
+    << "\tbefore\tafter\t\tbefore\tafter\t\tbefore\tafter\n"
+  ;
+  for (size_t size = 1024; size <= (1U << 20); size *= 4)
+  {
+    string const a(size, '_'), b(size, 'X');
+    forward_list<char> const fa(a.begin(), a.end());
+    list<char> const lb(b.begin(), b.end());
+    string child;
+    child.reserve(size);
+    string buffer(size, '\0');
+
+    // Returns the crossover() (or baseline_crossover()) runs to time...
+    auto const runs =
+      [&](auto const& cross)
+      {
+        auto const to_string =
+          [&](auto const& p1, auto const& p2, auto& re1, auto& re2)
+          {
+            child.clear();
+            cross(npoints, re1, re2, p1, p2, back_inserter(child));
+            return static_cast<size_t>(child[size/2]);
+          }
+        ;
+        auto const to_pointer =
+          [&](auto const& p1, auto const& p2, auto& re1, auto& re2)
+          {
+            cross(npoints, re1, re2, p1, p2, buffer.data());
+            return static_cast<size_t>(buffer[size/2]);
+          }
+        ;
+        return pair{ to_string, to_pointer };
+      }
+    ;
+    auto const [old_to_string, old_to_pointer] = runs(
+      [](auto&&... args) { return baseline_crossover(args...); }
+    );
+    auto const [to_string, to_pointer] = runs(
+      [](auto&&... args) { return crossover(args...); }
+    );
+
+    cout
+      << size << '\t'
+      << megabytes_per_second(a, b, size, old_to_string) << '\t'
+      << megabytes_per_second(a, b, size, to_string) << "\t\t"
+      << megabytes_per_second(a, b, size, old_to_pointer) << '\t'
+      << megabytes_per_second(a, b, size, to_pointer) << "\t\t"
+      << megabytes_per_second(fa, lb, size, old_to_string) << '\t'
+      << megabytes_per_second(fa, lb, size, to_string) << '\n'
+    ;
+  }
+}
+
+//=============================================================================
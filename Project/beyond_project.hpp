@@ -4,9 +4,14 @@
 //=============================================================================
 
 #include <algorithm>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <random>
@@ -257,10 +262,12 @@ requires
     std::ranges::range_value_t<StringA>,
     std::ranges::range_value_t<StringB>
   >
-constexpr std::size_t levenshtein(StringA const& a, StringB const& b)
+constexpr std::size_t levenshtein(
+  StringA const& a,
+  StringB const& b,
+  project::levenshtein_workspace& ws
+)
 {
-  using namespace std;
-
   //
   // This example solution is more general than project requirements and is not
   // what one was to write in the project. It has been provided so you can see
@@ -268,44 +275,210 @@ constexpr std::size_t levenshtein(StringA const& a, StringB const& b)
   //   * one is able to relax the requirement that StringA and StringB must
   //     be std::ranges::forward_range which allows this function to be used
   //     with more range types, and,
-  //       - Notice the code using iterators instead of indices which works
-  //         since things are nicely processed in passed and the values needed
-  //         to be accessed and stored can easily be computed.
+  //       - Notice the code (in project::detail::levenshtein_two_rows) using
+  //         iterators instead of indices which works since things are nicely
+  //         processed in passed and the values needed to be accessed and
+  //         stored can easily be computed.
+  //       - The bit-parallel engine used for byte-sized elements also only
+  //         needs a single pass over each range.
   //   * one is able to remove the sized_range requirements at the cost of
   //     some time --but such is one (quick) single-pass compared to the 
   //     multiple-passes required in the Levenshtein dynamic programming 
   //     algorithm code.
+  //   * knowing both sizes allows the shortest range to always be the inner
+  //     dimension which keeps the rows small (and therefore the amount of
+  //     work done smaller).
   //
+  return project::detail::levenshtein_impl(
+    a, static_cast<std::size_t>(range_size(a)),
+    b, static_cast<std::size_t>(range_size(b)),
+    ws
+  );
+}
 
-  auto const bsize = range_size(b);
+// Same as levenshtein(a,b,ws) using this thread's workspace (or a temporary
+// one during constant evaluation).
+template <typename StringA, typename StringB>
+requires
+  std::ranges::forward_range<StringA> &&
+  std::ranges::forward_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  >
+constexpr std::size_t levenshtein(StringA const& a, StringB const& b)
+{
+  auto const asize = static_cast<std::size_t>(range_size(a));
+  auto const bsize = static_cast<std::size_t>(range_size(b));
+  if (std::is_constant_evaluated())
+  {
+    project::levenshtein_workspace ws;
+    return project::detail::levenshtein_impl(a, asize, b, bsize, ws);
+  }
+  else
+    return project::detail::levenshtein_impl(
+      a, asize, b, bsize,
+      project::detail::thread_levenshtein_workspace()
+    );
+}
 
-  vector<size_t> prev_row(bsize+1);
-  iota(prev_row.begin(), prev_row.end(), size_t{});
+//=============================================================================
+
+//
+// edit_op
+// enum class
+//
+// The operations of an edit script transforming a range a into a range b:
+//   * match is an element of a kept as-is (equal to the element of b)
+//   * substitute is an element of a replaced with an element of b
+//   * insert is an element of b inserted
+//   * erase is an element of a deleted
+//
+enum class edit_op : unsigned char
+{
+  match,
+  substitute,
+  insert,
+  erase
+};
 
-  vector<size_t> cur_row(bsize+1, 0);
+//
+// levenshtein_alignment(a, b, out)
+//
+// Writes a minimum-cost edit script transforming a into b to out, in order,
+// as edit_op values and returns the resulting output iterator. The number of
+// non-match operations written is levenshtein(a,b).
+//
+// This uses Hirschberg's divide-and-conquer algorithm: a is split in half and
+// the two-row DP is run forwards over the first half and backwards over the
+// second half to find where the optimal path crosses the middle row. Each
+// half is then solved recursively. Only O(|a|+|b|) memory is used (instead of
+// the O(|a|*|b|) memory required to store the whole DP matrix).
+//
+// NOTE: Iterators to the elements of a and b are stored so that the ranges
+//       can be indexed (and traversed backwards) when only being forward
+//       ranges.
+//
+template <typename StringA, typename StringB, typename OutIter>
+requires
+  std::ranges::forward_range<StringA> &&
+  std::ranges::forward_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  > &&
+  std::output_iterator<OutIter, edit_op>
+OutIter levenshtein_alignment(StringA const& a, StringB const& b, OutIter out)
+{
+  using namespace std;
 
-  size_t i_dist_plus_one{1};
-  for (auto i=ranges::cbegin(a); i != ranges::cend(a); ++i, ++i_dist_plus_one)
-  {
-    cur_row.front() = i_dist_plus_one;
+  vector<ranges::iterator_t<StringA const>> ai;
+  for (auto i = ranges::cbegin(a); i != ranges::cend(a); ++i)
+    ai.push_back(i);
+  vector<ranges::iterator_t<StringB const>> bi;
+  for (auto i = ranges::cbegin(b); i != ranges::cend(b); ++i)
+    bi.push_back(i);
+
+  size_t const bsize = bi.size();
+
+  // Scratch rows: fwd and rev are the results, tmp is the other row...
+  vector<size_t> rows(3*(bsize+1));
+  size_t* const fwd = rows.data();
+  size_t* const rev = fwd + bsize+1;
+  size_t* const tmp = rev + bsize+1;
+
+  // Computes into result the last DP row of a[a0,a1) versus b[b0,b1) where
+  // the ranges are traversed forwards or backwards (reversed)...
+  auto const last_row =
+    [&](
+      size_t const a0, size_t const a1, size_t const b0, size_t const b1,
+      bool const reversed, size_t* result
+    )
     {
-      auto cur_row_iter = cur_row.begin();
-      auto prev_row_iter = prev_row.begin();
-      for (
-        auto j=ranges::cbegin(b); 
-        j != ranges::cend(b); 
-        ++j, ++prev_row_iter, ++cur_row_iter
-      )
+      size_t const n = b1-b0;
+      size_t* prev_row = result;
+      size_t* cur_row = tmp;
+      iota(prev_row, prev_row+n+1, size_t{});
+      for (size_t i{}; i != a1-a0; ++i)
       {
-        size_t const insert_cost = *cur_row_iter+1;
-        size_t const subst_cost = *prev_row_iter + (*i != *j);
-        size_t const del_cost = *std::next(prev_row_iter)+1;
-        *std::next(cur_row_iter) = min(del_cost, insert_cost, subst_cost);
+        auto const& x = reversed ? *ai[a1-1-i] : *ai[a0+i];
+        cur_row[0] = i+1;
+        for (size_t j{}; j != n; ++j)
+        {
+          auto const& y = reversed ? *bi[b1-1-j] : *bi[b0+j];
+          size_t const insert_cost = cur_row[j]+1;
+          size_t const subst_cost = prev_row[j] + (x != y);
+          size_t const del_cost = prev_row[j+1]+1;
+          cur_row[j+1] = min(del_cost, insert_cost, subst_cost);
+        }
+        swap(prev_row, cur_row);
       }
+      if (prev_row != result)
+        copy_n(prev_row, n+1, result);
     }
-    swap(prev_row, cur_row);
-  }
-  return prev_row.back();
+  ;
+
+  auto const emit = 
+    [&](edit_op const op, size_t const count) 
+    { 
+      for (size_t k{}; k != count; ++k)
+      {
+        *out = op;
+        ++out;
+      }
+    }
+  ;
+
+  auto const align =
+    [&](auto const& self, size_t const a0, size_t const a1, 
+      size_t const b0, size_t const b1) -> void
+    {
+      if (a0 == a1)
+        emit(edit_op::insert, b1-b0);
+      else if (b0 == b1)
+        emit(edit_op::erase, a1-a0);
+      else if (a1-a0 == 1)
+      {
+        // A single element of a: match it if possible, else substitute it...
+        auto const& x = *ai[a0];
+        size_t k = b0;
+        while (k != b1 && *bi[k] != x)
+          ++k;
+        if (k != b1)
+        {
+          emit(edit_op::insert, k-b0);
+          emit(edit_op::match, 1);
+          emit(edit_op::insert, b1-k-1);
+        }
+        else
+        {
+          emit(edit_op::substitute, 1);
+          emit(edit_op::insert, b1-b0-1);
+        }
+      }
+      else
+      {
+        // Find where the optimal path crosses row amid...
+        size_t const amid = a0 + (a1-a0)/2;
+        size_t const n = b1-b0;
+        last_row(a0, amid, b0, b1, false, fwd);
+        last_row(amid, a1, b0, b1, true, rev);
+        size_t bmid = b0;
+        size_t best = fwd[0] + rev[n];
+        for (size_t j{1}; j <= n; ++j)
+          if (fwd[j] + rev[n-j] < best)
+          {
+            best = fwd[j] + rev[n-j];
+            bmid = b0+j;
+          }
+
+        self(self, a0, amid, b0, bmid);
+        self(self, amid, a1, bmid, b1);
+      }
+    }
+  ;
+  align(align, 0, ai.size(), 0, bsize);
+  return out;
 }
 
 //=============================================================================
@@ -392,11 +565,13 @@ private:
   // any URBG in the end iterator)...
   std::optional<std::reference_wrapper<urbg_type>> urbg_;
   uint_type const pop_size_{};
-  uint_type num_in_pop_left_;
   uint_type last_i_;
-  uint_type i_;
   region region_;
 
+  // Selects the region ends: the smallest of reverse_id samples from
+  // [1,pop_size_] in increasing order (see the constructor)...
+  project::detail::sequential_sampler<uint_type> sampler_;
+
   constexpr void next()
   {
     if (region_.reverse_id == 0)
@@ -404,26 +579,17 @@ private:
       urbg_.reset();
     else
     {
-      for (bool not_found = true; not_found; ++i_)
-      {
-        uint_type const r = std::uniform_int_distribution<uint_type>
-          (0,--num_in_pop_left_)(urbg_->get());
-        ;
-
-        if (r < region_.reverse_id)
-        {
-          // Region [last_i_,i_) is the next region...
-          if (last_i_ > 0)
-            ++region_.id;
-          region_.from = last_i_;
-          // If --region.reverse_id == 0 then this is the last interval so 
-          // region_.to needs to be set to pop_size_...
-          region_.to = (--region_.reverse_id > 0) ? i_ : pop_size_;
-
-          last_i_ = i_;
-          not_found = false;
-        }
-      }
+      // Region [last_i_,i) is the next region...
+      if (last_i_ > 0)
+        ++region_.id;
+      region_.from = last_i_;
+      // If --region.reverse_id == 0 then this is the last interval so 
+      // region_.to needs to be set to pop_size_ (and the last sample need
+      // not be generated)...
+      if (--region_.reverse_id > 0)
+        region_.to = last_i_ = sampler_(urbg_->get()) + 1;
+      else
+        region_.to = pop_size_;
     }
   }
 
@@ -441,19 +607,27 @@ public:
   ) :
     urbg_{urbg},
     pop_size_{pop_size},
-    num_in_pop_left_{pop_size},
     last_i_{},
-    i_{1},      // i_ needs to be one ahead of last_i_ to start
     region_{
       min(num_regions,pop_size),  // reverse id
       {},                         // starting id
       {}, {}                      // [from,to)
+    },
+    sampler_{
+      pop_size,
+      num_regions > 1 ? min(num_regions,pop_size) : uint_type{},
+      urbg
     }
   {
-    // NOTES: Reservoir sampling will generate k PRNG values thus:
-    //   * num_regions will correspond to k-1 samples
+    // NOTES: k = min(num_regions,pop_size) values are sampled from
+    //        [1,pop_size] thus:
+    //   * num_regions will correspond to k-1 samples (the k-th sample is
+    //     replaced by pop_size)
     //   * pop_size can only have at most pop_size-1 regions as each
     //     region must at least be of size one
+    //   * the samples are generated in increasing order as they are needed
+    //     in O(k) time (instead of drawing a random number for every value
+    //     in [1,pop_size])
 
     if (num_regions == 0)
     {
@@ -514,6 +688,79 @@ public:
 
 //=============================================================================
 
+namespace detail {
+
+//
+// The container a std::back_insert_iterator appends to. (The container
+// pointer is a protected member so it is accessed through a derived class.)
+//
+template <typename Container>
+Container& back_insert_container(std::back_insert_iterator<Container> const& i)
+{
+  struct access : std::back_insert_iterator<Container>
+  {
+    static Container* get(std::back_insert_iterator<Container> const& i)
+    {
+      return i.*(&access::container);
+    }
+  };
+  return *access::get(i);
+}
+
+//
+// bulk_copy_n(first, n, out)
+//
+// The same as std::ranges::copy_n(first, n, out) except when first is a
+// contiguous iterator to trivially copyable elements the copy is done in
+// bulk (i.e., with std::memcpy or a container's range insert):
+//   * if out is a contiguous iterator to the same element type, the elements
+//     are copied with std::memcpy, or,
+//   * if out is a std::back_insert_iterator to a container having a range
+//     insert, the elements are appended with one insert() call (e.g., which
+//     std::string and std::vector do with one memmove).
+//
+template <std::input_iterator In, typename Out>
+constexpr std::ranges::copy_n_result<In, Out> bulk_copy_n(
+  In first,
+  std::iter_difference_t<In> const n,
+  Out out
+)
+{
+  using namespace std;
+  using value_type = iter_value_t<In>;
+
+  if constexpr(contiguous_iterator<In> && is_trivially_copyable_v<value_type>)
+  {
+    if (!is_constant_evaluated() && n > 0)
+    {
+      value_type const* const src = to_address(first);
+      if constexpr(requires {
+        requires contiguous_iterator<Out>;
+        requires same_as<iter_value_t<Out>, value_type>;
+      })
+      {
+        memcpy(to_address(out), src, static_cast<size_t>(n)*sizeof(value_type));
+        return { first + n, out + n };
+      }
+      else if constexpr(requires (Out o) {
+        back_insert_container(o).insert(
+          back_insert_container(o).end(), src, src
+        );
+      })
+      {
+        auto& c = back_insert_container(out);
+        c.insert(c.end(), src, src + n);
+        return { first + n, out };
+      }
+    }
+  }
+  return ranges::copy_n(first, n, out);
+}
+
+} // namespace detail
+
+//=============================================================================
+
 //
 // This example solution is more general than project requirements and is not
 // what one was to write in the project. It has been provided so you can see
@@ -586,32 +833,274 @@ constexpr auto crossover(
   region_sample_iterator i{urbg_crossover_points, sz, ncrossover_points+1};
   region_sample_iterator<std::remove_cvref_t<URBG2>> i_end{};
 
+  // Copies sz elements from one parent while moving the other parent's
+  // iterator past the same elements...
+  auto const copy_segment =
+    [&](auto& from, auto& other, size_t const sz)
+    {
+      using from_iter = remove_cvref_t<decltype(from)>;
+      using other_iter = remove_cvref_t<decltype(other)>;
+      auto const n = static_cast<iter_difference_t<from_iter>>(sz);
+      if constexpr(
+        !random_access_iterator<from_iter> &&
+        !random_access_iterator<other_iter>
+      )
+      {
+        // Neither parent can jump ahead so walk both in a single pass...
+        for (size_t k{}; k != sz; ++k, ++from, ++other, ++out)
+          *out = *from;
+      }
+      else
+      {
+        auto const r = detail::bulk_copy_n(from, n, out);
+        from = r.in;
+        out = r.out;
+        ranges::advance(other, static_cast<iter_difference_t<other_iter>>(sz));
+      }
+    }
+  ;
+
   for (; i != i_end; ++i)
   {
     auto const sz = i->to - i->from;
 
     if (which_parent)
-      out = ranges::copy_n(p1it, sz, out).out;
+      copy_segment(p1it, p2it, sz);
     else
-      out = ranges::copy_n(p2it, sz, out).out;
+      copy_segment(p2it, p1it, sz);
 
     which_parent = !which_parent;
-    advance(p1it, sz);
-    advance(p2it, sz);
   }
 
   if (copy_longer_range_tail)
   {
+    // NOTE: The tail's length is only known in O(1) time for sized ranges...
+    auto const copy_tail =
+      [&](auto const& from, auto const& parent)
+      {
+        if constexpr(ranges::sized_range<decltype(parent)>)
+          out = detail::bulk_copy_n(from,
+            static_cast<iter_difference_t<remove_cvref_t<decltype(from)>>>(
+              ranges::size(parent) - sz
+            ),
+            out
+          ).out;
+        else
+          out = ranges::copy(from, ranges::cend(parent), out).out;
+      }
+    ;
     if (!which_parent)
-      out = ranges::copy(p1it, ranges::cend(parent1), out).out;
+      copy_tail(p1it, parent1);
     else
-      out = ranges::copy(p2it, ranges::cend(parent2), out).out;
+      copy_tail(p2it, parent2);
   }
   return out;
 }
 
 //=============================================================================
 
+namespace detail {
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+//
+// Writes out[i] = b[i] or a[i] for i in [0,n) choosing b[i] when a random
+// 16-bit value is < threshold (0 < threshold < 65536), 32 bytes per step, by
+// comparing random values to threshold to form a byte mask and blending a and
+// b with it. Returns the number of bytes written (the rest, fewer than 32,
+// are left for the scalar code).
+//
+__attribute__((target("avx2")))
+inline std::size_t uniform_blend_avx2(
+  unsigned char const* const a, unsigned char const* const b,
+  unsigned char* const out, std::size_t const n,
+  std::uint32_t const threshold,
+  project::detail::xorshift128p_lanes& lanes
+)
+{
+  using namespace project::detail;
+
+  __m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(lanes.s0));
+  __m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(lanes.s1));
+  __m256i const vthreshold_minus_one =
+    _mm256_set1_epi16(static_cast<short>(threshold-1));
+
+  std::size_t i{};
+  for (; n - i >= 32; i += 32)
+  {
+    // NOTE: packs interleaves the 128-bit halves of the two masks which is
+    //       harmless since every mask byte is independent.
+    __m256i const mask = _mm256_packs_epi16(
+      less_epu16_avx2(xorshift128p_next_avx2(s0, s1), vthreshold_minus_one),
+      less_epu16_avx2(xorshift128p_next_avx2(s0, s1), vthreshold_minus_one)
+    );
+    __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a+i));
+    __m256i const y = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b+i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out+i),
+      _mm256_blendv_epi8(x, y, mask));
+  }
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.s0), s0);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.s1), s1);
+  return i;
+}
+
+#endif // #ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+} // namespace detail
+
+//
+// uniform_crossover(parent1, parent2, out, urbg, p, copy_longer_range_tail)
+//
+// Writes a child to out whose element i (for i less than the shorter
+// parent's length) is parent2's element i with probability p and parent1's
+// element i otherwise, each independently. If copy_longer_range_tail is true
+// the rest of the longer parent is then written. Returns the resulting
+// output iterator (i.e., the same output design as crossover() above).
+//
+// The random bits come from xorshift128+ generators seeded from urbg (see
+// project::char_mutator::fill()) and p is rounded to a multiple of 1/65536.
+//
+// When both parents are contiguous ranges of bytes (e.g., std::string) and
+// the CPU supports AVX2, 32 elements are produced per step by blending the
+// parents with random byte masks. If out is also a contiguous iterator
+// (e.g., a pointer or std::string::iterator), the blend is stored to out
+// directly; otherwise it goes through a small stack buffer.
+//
+// NOTE: As with char_mutator::fill(), the AVX2 code consumes the random
+//       values in a different order than the scalar code.
+//
+template <
+  std::ranges::forward_range Parent1,
+  std::ranges::forward_range Parent2,
+  typename OutIndividual,
+  typename URBG
+>
+requires
+  std::uniform_random_bit_generator<std::remove_cvref_t<URBG>> &&
+  std::same_as<
+    std::ranges::range_value_t<Parent1>,
+    std::ranges::range_value_t<Parent2>
+  > &&
+  std::output_iterator<OutIndividual, std::ranges::range_value_t<Parent1>>
+OutIndividual uniform_crossover(
+  Parent1 const& parent1,
+  Parent2 const& parent2,
+  OutIndividual out,
+  URBG&& urbg,
+  double const p = 0.5,
+  bool const copy_longer_range_tail = true
+)
+{
+  using namespace std;
+  using value_type = ranges::range_value_t<Parent1>;
+
+  size_t const sz = min_range_size(parent1, parent2);
+  auto p1it = ranges::cbegin(parent1);
+  auto p2it = ranges::cbegin(parent2);
+
+  uint32_t const threshold =
+    p <= 0.0 ? 0 :
+    p >= 1.0 ? 65536 :
+    static_cast<uint32_t>(std::min(std::lround(p * 65536.0), 65536L))
+  ;
+
+  auto const copy_tail =
+    [&]()
+    {
+      if (copy_longer_range_tail)
+      {
+        out = ranges::copy(p1it, ranges::cend(parent1), out).out;
+        out = ranges::copy(p2it, ranges::cend(parent2), out).out;
+      }
+      return out;
+    }
+  ;
+
+  // Without randomness the child is a copy of one parent...
+  if (threshold == 0)
+  {
+    auto const r = ranges::copy_n(p1it, static_cast<ptrdiff_t>(sz), out);
+    p1it = r.in;
+    out = r.out;
+    ranges::advance(p2it, static_cast<ptrdiff_t>(sz));
+    return copy_tail();
+  }
+  if (threshold == 65536)
+  {
+    auto const r = ranges::copy_n(p2it, static_cast<ptrdiff_t>(sz), out);
+    p2it = r.in;
+    out = r.out;
+    ranges::advance(p1it, static_cast<ptrdiff_t>(sz));
+    return copy_tail();
+  }
+
+  project::detail::xorshift128p_lanes lanes(urbg);
+  size_t i{};
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+  if constexpr(
+    ranges::contiguous_range<Parent1> && ranges::contiguous_range<Parent2> &&
+    sizeof(value_type) == 1 && is_trivially_copyable_v<value_type>
+  )
+  {
+    if (sz >= 32 && project::detail::cpu_supports_avx2())
+    {
+      auto const* const a =
+        reinterpret_cast<unsigned char const*>(ranges::data(parent1));
+      auto const* const b =
+        reinterpret_cast<unsigned char const*>(ranges::data(parent2));
+      if constexpr(requires {
+        requires contiguous_iterator<OutIndividual>;
+        requires same_as<iter_value_t<OutIndividual>, value_type>;
+      })
+      {
+        i = detail::uniform_blend_avx2(a, b,
+          reinterpret_cast<unsigned char*>(to_address(out)), sz, threshold,
+          lanes);
+        out += static_cast<iter_difference_t<OutIndividual>>(i);
+      }
+      else
+      {
+        alignas(32) value_type buf[1024];
+        for (size_t n; (n = std::min(sz - i, sizeof buf) / 32 * 32) != 0; )
+        {
+          detail::uniform_blend_avx2(a+i, b+i,
+            reinterpret_cast<unsigned char*>(buf), n, threshold, lanes);
+          out = ranges::copy_n(buf, static_cast<ptrdiff_t>(n), out).out;
+          i += n;
+        }
+      }
+      ranges::advance(p1it, static_cast<ptrdiff_t>(i));
+      ranges::advance(p2it, static_cast<ptrdiff_t>(i));
+    }
+  }
+#endif
+
+  // Blend the rest one element at a time using 16-bit random values...
+  uint64_t bits{};
+  unsigned nbits{};
+  size_t lane{};
+  for (; i != sz; ++i, ++p1it, ++p2it)
+  {
+    if (nbits == 0)
+    {
+      bits = lanes.next(lane);
+      lane = (lane + 1) % 4;
+      nbits = 64;
+    }
+    bool const second = (bits & 0xFFFF) < threshold;
+    bits >>= 16;
+    nbits -= 16;
+
+    *out = second ? *p2it : *p1it;
+    ++out;
+  }
+  return copy_tail();
+}
+
+//=============================================================================
+
 } // namespace beyond_project
 } // namespace comp3400
 } // namespace uwindsor_2023w
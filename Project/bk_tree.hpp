@@ -0,0 +1,317 @@
+#ifndef uwindsor_2023w_comp3400_project_bk_tree_hpp_
+#define uwindsor_2023w_comp3400_project_bk_tree_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "project.hpp"
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// bk_tree<String>
+// class template
+//
+// A Burkhard-Keller tree of String values indexed by levenshtein() distance
+// for fuzzy lookups, e.g., finding dictionary entries near a query string.
+//
+// Each node has one child per distinct distance d to its value: the child's
+// subtree holds exactly the values at distance d from the node's value. By the
+// triangle inequality, if a query is distance dq from a node's value then a
+// value within k of the query can only be in the subtrees with
+// |d-dq| <= k, so most subtrees are never visited.
+//
+// Values are identified by their insertion index, i.e., the tree built from
+// a range r has value(i) == r[i]. Duplicate values are kept (as children at
+// distance 0) so every inserted value has an index.
+//
+// Distances are computed with levenshtein_within() bounded by the largest
+// distance that can still matter at a node, so nodes far from the query are
+// rejected in O(k*n) time instead of O(n*m).
+//
+template <typename String>
+requires
+  std::ranges::sized_range<String> &&
+  std::ranges::random_access_range<String>
+class bk_tree
+{
+public:
+  using value_type = String;
+  using size_type = std::size_t;
+
+  // A query result: the index of a value and its distance from the query.
+  struct match
+  {
+    size_type index;
+    size_type distance;
+
+    friend constexpr bool operator==(match const&, match const&) = default;
+    friend constexpr auto operator<=>(match const& a, match const& b) noexcept
+    {
+      if (auto const cmp = a.distance <=> b.distance; cmp != 0)
+        return cmp;
+      return a.index <=> b.index;
+    }
+  };
+
+private:
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  using child = std::pair<size_type,size_type>;  // (distance, node index)
+
+  struct node
+  {
+    std::vector<child> children;  // sorted by (unique) distance
+  };
+
+  std::vector<String> values_;  // values_[i] is node i's value
+  std::vector<node> nodes_;
+
+  // Returns a+b or npos if such overflows.
+  static constexpr size_type add(size_type const a, size_type const b) noexcept
+  {
+    return (a > npos-b) ? npos : a+b;
+  }
+
+  // Returns levenshtein(query,value) if such is <= bound, otherwise returns
+  // npos.
+  template <typename Query>
+  static size_type bounded_distance(
+    Query const& query,
+    String const& value,
+    size_type const bound,
+    levenshtein_workspace& ws
+  )
+  {
+    if (bound == npos)
+      return levenshtein(query, value, ws);
+    auto const d = levenshtein_within(query, value, bound, ws);
+    return d ? *d : npos;
+  }
+
+  // Returns the range of children of node n with distances in [lo,hi].
+  auto children_between(
+    size_type const n,
+    size_type const lo,
+    size_type const hi
+  ) const
+  {
+    using namespace std;
+
+    auto const& c = nodes_[n].children;
+    auto const first = ranges::lower_bound(c, lo, {}, &child::first);
+    auto const last =
+      ranges::upper_bound(first, c.end(), hi, {}, &child::first);
+    return ranges::subrange(first, last);
+  }
+
+  // Returns the largest child distance of node n (0 if n is a leaf).
+  size_type max_child_distance(size_type const n) const noexcept
+  {
+    auto const& c = nodes_[n].children;
+    return c.empty() ? 0 : c.back().first;
+  }
+
+public:
+  bk_tree() = default;
+
+  template <std::ranges::input_range R>
+  requires std::constructible_from<String, std::ranges::range_reference_t<R>>
+  explicit bk_tree(R&& r)
+  {
+    if constexpr(std::ranges::sized_range<R>)
+    {
+      values_.reserve(std::ranges::size(r));
+      nodes_.reserve(std::ranges::size(r));
+    }
+    for (auto&& value : r)
+      insert(std::forward<decltype(value)>(value));
+  }
+
+  size_type size() const noexcept { return values_.size(); }
+  bool empty() const noexcept { return values_.empty(); }
+  String const& value(size_type const i) const noexcept { return values_[i]; }
+  std::vector<String> const& values() const noexcept { return values_; }
+
+  // Adds value to the tree. Returns value's index.
+  template <typename U>
+  requires std::constructible_from<String, U&&>
+  size_type insert(U&& value)
+  {
+    using namespace std;
+
+    size_type const index = values_.size();
+    values_.emplace_back(std::forward<U>(value));
+    nodes_.emplace_back();
+
+    if (index == 0)
+      return index;
+
+    auto& ws = detail::thread_levenshtein_workspace();
+    String const& v = values_.back();
+    size_type n{};
+    for (;;)
+    {
+      size_type const d = levenshtein(v, values_[n], ws);
+      auto& c = nodes_[n].children;
+      auto const pos = ranges::lower_bound(c, d, {}, &child::first);
+      if (pos == c.end() || pos->first != d)
+      {
+        c.emplace(pos, d, index);
+        return index;
+      }
+      n = pos->second;
+    }
+  }
+
+  // Writes a match for each value within distance k of query to out (in no
+  // particular order) and returns the resulting output iterator.
+  template <typename Query, std::output_iterator<match> OutIter>
+  OutIter find_within(Query const& query, size_type const k, OutIter out) const
+  {
+    using namespace std;
+
+    if (empty())
+      return out;
+
+    auto& ws = detail::thread_levenshtein_workspace();
+    vector<size_type> stack{ 0 };
+    while (!stack.empty())
+    {
+      size_type const n = stack.back();
+      stack.pop_back();
+
+      // Children are only visited when d <= max_child_distance(n)+k...
+      size_type const d =
+        bounded_distance(query, values_[n], add(max_child_distance(n), k), ws);
+      if (d == npos)
+        continue;
+
+      if (d <= k)
+        *out++ = match{ n, d };
+      for (auto const& c : children_between(n, d > k ? d-k : 0, add(d, k)))
+        stack.push_back(c.second);
+    }
+    return out;
+  }
+
+  // Returns the matches of the values within distance k of query sorted by
+  // distance (then by index).
+  template <typename Query>
+  std::vector<match> find_within(Query const& query, size_type const k) const
+  {
+    std::vector<match> retval;
+    find_within(query, k, std::back_inserter(retval));
+    std::ranges::sort(retval);
+    return retval;
+  }
+
+  // Returns the matches of the (at most) count values nearest query sorted by
+  // distance (then by index).
+  //
+  // The tree is searched depth-first visiting the children of a node in
+  // increasing order of their triangle inequality lower bound |d-dq| so the
+  // search radius shrinks as quickly as possible. A pending subtree is
+  // skipped if its lower bound exceeds the radius by the time it is visited.
+  template <typename Query>
+  std::vector<match> nearest(Query const& query, size_type const count) const
+  {
+    using namespace std;
+
+    vector<match> best;  // max-heap of the best count matches so far
+    if (empty() || count == 0)
+      return best;
+    best.reserve(count);
+
+    // The current search radius, i.e., the worst distance in best once
+    // count matches have been found...
+    auto const radius =
+      [&]() { return best.size() < count ? npos : best.front().distance; };
+
+    auto& ws = detail::thread_levenshtein_workspace();
+
+    // (lower bound, node index) of subtrees to visit...
+    vector<pair<size_type,size_type>> stack{ {0, 0} };
+    while (!stack.empty())
+    {
+      auto const [lower_bound, n] = stack.back();
+      stack.pop_back();
+      if (lower_bound > radius())
+        continue;
+
+      size_type const d = bounded_distance(
+        query, values_[n], add(max_child_distance(n), radius()), ws
+      );
+      if (d == npos)
+        continue;
+
+      match const m{ n, d };
+      if (best.size() < count)
+      {
+        best.push_back(m);
+        ranges::push_heap(best);
+      }
+      else if (m < best.front())
+      {
+        ranges::pop_heap(best);
+        best.back() = m;
+        ranges::push_heap(best);
+      }
+
+      // Push the children from the outside in, i.e., the child whose
+      // distance is closest to d is on the top of the stack...
+      auto const bound_of =
+        [d](child const& c) { return c.first > d ? c.first-d : d-c.first; };
+      size_type const r = radius();
+      auto children = children_between(n, d > r ? d-r : 0, add(d, r));
+      auto first = children.begin();
+      auto last = children.end();
+      while (first != last)
+      {
+        size_type const lo_bound = bound_of(*first);
+        size_type const hi_bound = bound_of(*prev(last));
+        if (lo_bound >= hi_bound)
+        {
+          stack.emplace_back(lo_bound, first->second);
+          ++first;
+        }
+        else
+        {
+          --last;
+          stack.emplace_back(hi_bound, last->second);
+        }
+      }
+    }
+
+    ranges::sort_heap(best);
+    return best;
+  }
+};
+
+template <std::ranges::input_range R>
+bk_tree(R&&) -> bk_tree<std::ranges::range_value_t<R>>;
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_bk_tree_hpp_
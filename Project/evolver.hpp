@@ -0,0 +1,674 @@
+#ifndef uwindsor_2023w_comp3400_project_evolver_hpp_
+#define uwindsor_2023w_comp3400_project_evolver_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils.hpp"
+#include "project.hpp"
+#include "beyond_project.hpp"
+#include "thread_pool.hpp"
+#include "philox.hpp"
+#include "fitness_cache.hpp"
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// levenshtein_fitness
+// class
+//
+// The default fitness function of an evolver: the levenshtein() distance of
+// an individual from the target (i.e., smaller is fitter and 0 is a match).
+//
+// A fitness function type is any type invocable as f(target,individual)
+// returning a std::size_t. Optionally it may have a batch(target,population,
+// out) member function to compute the fitness of many individuals at once
+// (which the evolver then uses).
+//
+struct levenshtein_fitness
+{
+  template <typename Target, typename Individual>
+  std::size_t operator()(Target const& target, Individual const& individual)
+    const
+  {
+    return levenshtein(target, individual);
+  }
+
+  template <typename Target, typename Population, typename OutIter>
+  OutIter batch(Target const& target, Population const& population,
+    OutIter out) const
+  {
+    return levenshtein_batch(target, population, out);
+  }
+};
+
+//
+// hamming_fitness
+// class
+//
+// A fitness function using the hamming() distance of an individual from the
+// target. It has the same interface as levenshtein_fitness and the same zero
+// (only the target scores 0) but it is a different fitness: it never scores
+// an individual better than levenshtein_fitness does and it ranks
+// individuals differently (e.g., it penalizes shifted elements heavily).
+// It is much faster and best suited to individuals of the target's length
+// with only substitution mutations (i.e., evolver_options::indel_rate is 0).
+//
+struct hamming_fitness
+{
+  template <typename Target, typename Individual>
+  std::size_t operator()(Target const& target, Individual const& individual)
+    const
+  {
+    return hamming(target, individual);
+  }
+
+  template <typename Target, typename Population, typename OutIter>
+  OutIter batch(Target const& target, Population const& population,
+    OutIter out) const
+  {
+    return hamming_batch(target, population, out);
+  }
+};
+
+//=============================================================================
+
+//
+// cached_fitness<Fitness>
+// class template
+//
+// A fitness function computing Fitness through a fitness_cache so duplicate
+// individuals are evaluated once: individuals found in the cache are not
+// recomputed and the rest are computed with Fitness (using its batch() if
+// it has one) and then cached.
+//
+// Copies share the same cache (e.g., the evolvers of an island_model) so the
+// cache must only be used with one target.
+//
+template <typename Fitness = levenshtein_fitness>
+class cached_fitness
+{
+private:
+  Fitness fitness_;
+  std::shared_ptr<fitness_cache> cache_;
+
+public:
+  cached_fitness() :
+    cached_fitness(std::size_t{1} << 16)
+  {
+  }
+
+  explicit cached_fitness(std::size_t const capacity, Fitness fitness = {}) :
+    fitness_(std::move(fitness)),
+    cache_{std::make_shared<fitness_cache>(capacity)}
+  {
+  }
+
+  explicit cached_fitness(
+    std::shared_ptr<fitness_cache> cache,
+    Fitness fitness = {}
+  ) :
+    fitness_(std::move(fitness)),
+    cache_{std::move(cache)}
+  {
+  }
+
+  fitness_cache& cache() const noexcept { return *cache_; }
+
+  template <typename Target, typename Individual>
+  std::size_t operator()(Target const& target, Individual const& individual)
+    const
+  {
+    return cache_->get_or_compute(individual,
+      [&](Individual const& i) -> std::size_t { return fitness_(target, i); });
+  }
+
+  template <typename Target, typename Population, typename OutIter>
+  requires std::ranges::random_access_range<Population const>
+  OutIter batch(Target const& target, Population const& population,
+    OutIter out) const
+  {
+    using namespace std;
+
+    // Look up every individual remembering the misses...
+    size_t const n = static_cast<size_t>(ranges::size(population));
+    vector<uint64_t> keys(n);
+    vector<size_t> values(n);
+    vector<size_t> misses;
+    for (size_t i{}; i != n; ++i)
+    {
+      keys[i] = fitness_cache::hash(population[i]);
+      if (auto const cached = cache_->find(keys[i]))
+        values[i] = *cached;
+      else
+        misses.push_back(i);
+    }
+
+    // Compute the misses all at once...
+    if (!misses.empty())
+    {
+      auto const missed = misses | views::transform(
+        [&](size_t const i) -> decltype(auto) { return population[i]; }
+      );
+      vector<size_t> computed(misses.size());
+      if constexpr(requires { fitness_.batch(target, missed, computed.begin()); })
+        fitness_.batch(target, missed, computed.begin());
+      else
+        ranges::transform(missed, computed.begin(),
+          [&](auto const& i) -> size_t { return fitness_(target, i); });
+      for (size_t k{}; k != misses.size(); ++k)
+      {
+        values[misses[k]] = computed[k];
+        cache_->insert(keys[misses[k]], computed[k]);
+      }
+    }
+    return ranges::copy(values, out).out;
+  }
+};
+
+//=============================================================================
+
+//
+// binary_tournament_selection
+// class
+//
+// The default selection strategy of an evolver: picks two individuals
+// uniformly at random and returns the index of the fitter one.
+//
+// A selection strategy type is any type invocable as s(fitness,urbg)
+// returning the index of the selected individual where fitness is a
+// std::span<std::size_t const> of the population's fitness values (smaller
+// is fitter). Optionally it may have a prepare(fitness) member function which
+// is called once per generation before any selections (e.g., to build
+// tables). See also roulette_selection and tournament_selection in
+// project.hpp.
+//
+struct binary_tournament_selection
+{
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  std::size_t operator()(std::span<std::size_t const> const fitness,
+    URBG&& urbg) const
+  {
+    std::uniform_int_distribution<std::size_t> ud(0, fitness.size()-1);
+    std::size_t const a = ud(urbg);
+    std::size_t const b = ud(urbg);
+    return fitness[b] < fitness[a] ? b : a;
+  }
+};
+
+template <typename S, typename URBG>
+concept selection_strategy =
+  std::uniform_random_bit_generator<URBG> &&
+  requires (S& s, std::span<std::size_t const> fitness, URBG& urbg)
+  {
+    { s(fitness, urbg) } -> std::convertible_to<std::size_t>;
+  }
+;
+
+//=============================================================================
+
+//
+// evolver_options
+// class
+//
+// The parameters of an evolver:
+//   * population_size is the number of individuals in each generation,
+//   * mutation_rate is the per-element mutation probability (see
+//     mutate_geometric()),
+//   * indel_rate is the per-element insertion/deletion probability (see
+//     mutate_indel(), only used if Individual is indel_editable, e.g.,
+//     gap_buffer<char>),
+//   * crossover_rate is the probability a child is the crossover() of two
+//     selected parents (otherwise it is a copy of the first parent),
+//   * max_crossover_points is the maximum number of crossover points (the
+//     number used is uniformly chosen from [1,max_crossover_points]),
+//   * elites is the number of the fittest individuals copied unchanged into
+//     the next generation,
+//   * seed seeds the evolver's random number engine,
+//   * threads is the number of threads computing fitness values (if > 1 the
+//     evolver owns a thread_pool for its lifetime), and,
+//   * evaluation_chunk is the number of individuals per parallel fitness
+//     computation task.
+//
+struct evolver_options
+{
+  std::size_t population_size = 1000;
+  double mutation_rate = 0.01;
+  double indel_rate = 0.0;
+  double crossover_rate = 0.7;
+  std::size_t max_crossover_points = 2;
+  std::size_t elites = 1;
+  std::uint64_t seed = 3400;
+  std::size_t threads = 1;
+  std::size_t evaluation_chunk = 256;
+};
+
+//
+// evolver_stats
+// class
+//
+// The state of an evolver's run: the number of generations run, the number
+// of fitness evaluations done, the best fitness (and the index of the
+// individual having it) in the current population, and the number of seconds
+// spent evolving.
+//
+struct evolver_stats
+{
+  std::size_t generation{};
+  std::size_t evaluations{};
+  std::size_t best_fitness = std::numeric_limits<std::size_t>::max();
+  std::size_t best_index{};
+  double seconds{};
+
+  double generations_per_second() const noexcept
+  {
+    return seconds > 0.0 ? generation / seconds : 0.0;
+  }
+
+  double evaluations_per_second() const noexcept
+  {
+    return seconds > 0.0 ? evaluations / seconds : 0.0;
+  }
+};
+
+//
+// Termination conditions for evolver::run(). A termination condition is any
+// type invocable as t(stats) returning true when the run should stop.
+//
+struct stop_after_generations
+{
+  std::size_t generations;
+
+  bool operator()(evolver_stats const& s) const noexcept
+  {
+    return s.generation >= generations;
+  }
+};
+
+struct stop_at_fitness
+{
+  std::size_t fitness = 0;
+
+  bool operator()(evolver_stats const& s) const noexcept
+  {
+    return s.best_fitness <= fitness;
+  }
+};
+
+//=============================================================================
+
+namespace detail {
+
+// Returns the mutation function object mutate_geometric() and mutate_indel()
+// are passed for elements of type T: m(element,urbg) bound to urbg if
+// Mutator is invocable so, otherwise m itself (i.e., the same stateful
+// object for every caller, so it must not be used concurrently).
+template <typename T, typename Mutator>
+decltype(auto) mutator_for(Mutator& m, philox4x32& urbg)
+{
+  if constexpr(std::invocable<Mutator const&, T, philox4x32&>)
+    return [&m,&urbg](T const& e) { return m(e, urbg); };
+  else
+    return (m);
+}
+
+} // namespace detail
+
+//=============================================================================
+
+//
+// evolver<Individual, Selection, Fitness, Mutator>
+// class template
+//
+// A generational genetic algorithm evolving a population of Individual
+// towards a target using Selection, crossover(), and mutate_geometric():
+//   * The population is double-buffered: each generation's children are
+//     written into the other buffer's individuals (reusing their memory) and
+//     then the buffers are swapped, i.e., in steady state a generation does
+//     not dynamically allocate any RAM.
+//   * The elites are copied unchanged so the best fitness never worsens.
+//   * The fitness of the children is computed in one pass after all
+//     children are created (using Fitness::batch() if it exists). With
+//     options().threads > 1 the children are split into evaluation_chunk
+//     sized chunks computed in parallel by the evolver's thread_pool (so
+//     Fitness must then be safe to call concurrently).
+//   * Child i of generation g draws all of its random numbers from
+//     philox4x32(seed, g, i), so children are bred in parallel (with
+//     options().threads > 1) and the results are bit-identical for any
+//     number of threads. Selection and Mutator must then be safe to call
+//     concurrently, e.g., stateless_char_mutator (but not char_mutator).
+//
+// A Mutator is invocable as m(element,urbg) (e.g., stateless_char_mutator)
+// or as m(element) (e.g., char_mutator, which is not reproducible).
+//
+// The initial population (generation 0) is made up of copies of the target
+// with every element mutated.
+//
+template <
+  typename Individual = std::string,
+  typename Selection = binary_tournament_selection,
+  typename Fitness = levenshtein_fitness,
+  typename Mutator = stateless_char_mutator
+>
+requires
+  std::ranges::random_access_range<Individual> &&
+  std::ranges::sized_range<Individual> &&
+  back_insertable<Individual> &&
+  (
+    std::invocable<Mutator const&, std::ranges::range_value_t<Individual>,
+      philox4x32&> ||
+    std::invocable<Mutator&, std::ranges::range_value_t<Individual>>
+  ) &&
+  selection_strategy<Selection, philox4x32>
+class evolver
+{
+public:
+  using individual_type = Individual;
+  using value_type = std::ranges::range_value_t<Individual>;
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  Individual target_;
+  evolver_options options_;
+  Selection selection_;
+  Fitness fitness_fn_;
+  Mutator mutator_;
+
+  // population_[current_] and fitness_[current_] are the current generation
+  std::vector<Individual> population_[2];
+  std::vector<std::size_t> fitness_[2];
+  std::size_t current_{};
+  std::vector<std::size_t> order_;  // scratch used to find the elites
+  std::unique_ptr<thread_pool> pool_;
+
+  evolver_stats stats_;
+
+  // Computes fitness_[buf][i] for i in [first,last)...
+  void evaluate_range(
+    std::size_t const buf,
+    std::size_t const first,
+    std::size_t const last
+  )
+  {
+    using namespace std;
+
+    auto const individuals =
+      span<Individual const>(population_[buf]).subspan(first, last-first);
+    auto out = fitness_[buf].begin() + first;
+    if constexpr(
+      requires { fitness_fn_.batch(target_, individuals, out); }
+    )
+      fitness_fn_.batch(target_, individuals, out);
+    else
+      ranges::transform(individuals, out,
+        [&](Individual const& i) { return fitness_fn_(target_, i); });
+  }
+
+  // Computes fitness_[buf][i] for i in [first,population_size)...
+  void evaluate(std::size_t const buf, std::size_t const first)
+  {
+    std::size_t const last = options_.population_size;
+    if (pool_)
+      pool_->parallel_for(first, last, options_.evaluation_chunk,
+        [&](std::size_t const b, std::size_t const e)
+        {
+          evaluate_range(buf, b, e);
+        }
+      );
+    else
+      evaluate_range(buf, first, last);
+    stats_.evaluations += last - first;
+  }
+
+  // Returns the mutation function object mutate_geometric() is passed...
+  decltype(auto) mutator_for(philox4x32& urbg)
+  {
+    return detail::mutator_for<value_type>(mutator_, urbg);
+  }
+
+  void update_best()
+  {
+    auto const& f = fitness_[current_];
+    auto const best = std::ranges::min_element(f);
+    stats_.best_index = static_cast<std::size_t>(best - f.begin());
+    stats_.best_fitness = *best;
+  }
+
+public:
+  template <std::ranges::input_range Target>
+  requires std::same_as<std::ranges::range_value_t<Target>, value_type>
+  evolver(
+    Target const& target,
+    evolver_options const& options,
+    Selection selection = {},
+    Fitness fitness = {},
+    Mutator mutator = {}
+  ) :
+    target_(std::ranges::begin(target), std::ranges::end(target)),
+    options_{options},
+    selection_(std::move(selection)),
+    fitness_fn_(std::move(fitness)),
+    mutator_(std::move(mutator))
+  {
+    using namespace std;
+
+    options_.population_size = std::max<size_t>(options_.population_size, 1);
+    options_.elites = std::min(options_.elites, options_.population_size);
+    for (auto& p : population_)
+      p.assign(options_.population_size, target_);
+    for (auto& f : fitness_)
+      f.resize(options_.population_size);
+    order_.resize(options_.population_size);
+    if (options_.threads > 1)
+      pool_ = std::make_unique<thread_pool>(options_.threads);
+
+    // Randomize the initial population (in bulk if the mutator can)...
+    for (size_t i{}; i != options_.population_size; ++i)
+    {
+      philox4x32 urbg(options_.seed, 0, i);
+      auto& individual = population_[current_][i];
+      if constexpr(
+        convertible_to<Individual&, span<char>> &&
+        requires { mutator_.fill(span<char>{}, urbg); }
+      )
+        mutator_.fill(span<char>(individual), urbg);
+      else
+        mutate_geometric(individual, 1.0, mutator_for(urbg), urbg);
+    }
+
+    auto const start = clock::now();
+    evaluate(current_, 0);
+    update_best();
+    stats_.seconds += chrono::duration<double>(clock::now() - start).count();
+  }
+
+  Individual const& target() const noexcept { return target_; }
+  evolver_options const& options() const noexcept { return options_; }
+  evolver_stats const& stats() const noexcept { return stats_; }
+  Fitness const& fitness_function() const noexcept { return fitness_fn_; }
+
+  std::vector<Individual> const& population() const noexcept
+  {
+    return population_[current_];
+  }
+
+  std::span<std::size_t const> fitness() const noexcept
+  {
+    return fitness_[current_];
+  }
+
+  Individual const& best() const noexcept
+  {
+    return population_[current_][stats_.best_index];
+  }
+
+  // Writes copies of the (at most) k fittest individuals (fittest first) to
+  // out and returns the resulting output iterator.
+  template <std::output_iterator<Individual const&> OutIter>
+  OutIter fittest(std::size_t k, OutIter out)
+  {
+    using namespace std;
+
+    auto const& f = fitness_[current_];
+    k = std::min(k, options_.population_size);
+    iota(order_.begin(), order_.end(), size_t{});
+    ranges::partial_sort(order_, order_.begin() + k, {},
+      [&](size_t const i) { return f[i]; });
+    for (size_t i{}; i != k; ++i)
+      *out++ = population_[current_][order_[i]];
+    return out;
+  }
+
+  // Replaces the least fit individuals of the current population with copies
+  // of immigrants and computes their fitness. At most population_size-1
+  // individuals are replaced so the fittest individual is never replaced.
+  template <std::ranges::forward_range Immigrants>
+  requires std::assignable_from<
+    Individual&, std::ranges::range_reference_t<Immigrants const>
+  >
+  void immigrate(Immigrants const& immigrants)
+  {
+    using namespace std;
+
+    auto const start = clock::now();
+
+    auto& p = population_[current_];
+    auto& f = fitness_[current_];
+    size_t const k = std::min(
+      static_cast<size_t>(ranges::distance(immigrants)),
+      options_.population_size-1
+    );
+    iota(order_.begin(), order_.end(), size_t{});
+    ranges::partial_sort(order_, order_.begin() + k, ranges::greater{},
+      [&](size_t const i) { return f[i]; });
+
+    auto immigrant = ranges::begin(immigrants);
+    for (size_t i{}; i != k; ++i, ++immigrant)
+    {
+      p[order_[i]] = *immigrant;
+      f[order_[i]] = fitness_fn_(target_, p[order_[i]]);
+    }
+    stats_.evaluations += k;
+    update_best();
+    stats_.seconds += chrono::duration<double>(clock::now() - start).count();
+  }
+
+  // Evolves one generation. Returns stats().
+  evolver_stats const& step()
+  {
+    using namespace std;
+
+    auto const start = clock::now();
+
+    size_t const n = options_.population_size;
+    size_t const next = 1-current_;
+    auto const& parents = population_[current_];
+    span<size_t const> const parent_fitness = fitness_[current_];
+    auto& children = population_[next];
+    auto& child_fitness = fitness_[next];
+
+    // Copy the elites...
+    size_t const elites = options_.elites;
+    if (elites != 0)
+    {
+      iota(order_.begin(), order_.end(), size_t{});
+      ranges::partial_sort(order_, order_.begin() + elites, {},
+        [&](size_t const i) { return parent_fitness[i]; });
+      for (size_t i{}; i != elites; ++i)
+      {
+        children[i] = parents[order_[i]];
+        child_fitness[i] = parent_fitness[order_[i]];
+      }
+    }
+
+    // Breed the rest...
+    if constexpr(requires { selection_.prepare(parent_fitness); })
+      selection_.prepare(parent_fitness);
+    auto const breed =
+      [&](size_t const first, size_t const last)
+      {
+        bernoulli_distribution do_crossover(options_.crossover_rate);
+        uniform_int_distribution<size_t> npoints(
+          1, std::max<size_t>(options_.max_crossover_points, 1)
+        );
+        for (size_t i = first; i != last; ++i)
+        {
+          philox4x32 urbg(
+            options_.seed, static_cast<uint32_t>(stats_.generation+1), i
+          );
+          Individual const& p1 = parents[selection_(parent_fitness, urbg)];
+          Individual& child = children[i];
+          if (do_crossover(urbg))
+          {
+            Individual const& p2 = parents[selection_(parent_fitness, urbg)];
+            child.clear();
+            beyond_project::crossover(
+              npoints(urbg), urbg, urbg, p1, p2, back_inserter(child)
+            );
+          }
+          else
+            child = p1;
+          mutate_geometric(
+            child, options_.mutation_rate, mutator_for(urbg), urbg
+          );
+          if constexpr(indel_editable<Individual>)
+            mutate_indel(child, options_.indel_rate, mutator_for(urbg), urbg);
+        }
+      }
+    ;
+    if (pool_)
+      pool_->parallel_for(elites, n, options_.evaluation_chunk, breed);
+    else
+      breed(elites, n);
+
+    evaluate(next, elites);
+    current_ = next;
+    ++stats_.generation;
+    update_best();
+    stats_.seconds += chrono::duration<double>(clock::now() - start).count();
+    return stats_;
+  }
+
+  // Evolves generations until done(stats()) is true (checked before each
+  // generation). Returns stats().
+  template <typename Terminate>
+  requires std::predicate<Terminate&, evolver_stats const&>
+  evolver_stats const& run(Terminate done)
+  {
+    while (!done(stats_))
+      step();
+    return stats_;
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_evolver_hpp_
@@ -0,0 +1,319 @@
+#ifndef uwindsor_2023w_comp3400_project_fitness_cache_hpp_
+#define uwindsor_2023w_comp3400_project_fitness_cache_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+namespace detail {
+
+// Returns the xor of the high and low halves of the 128-bit product a*b.
+inline std::uint64_t mum(std::uint64_t const a, std::uint64_t const b) noexcept
+{
+  unsigned __int128 const p = static_cast<unsigned __int128>(a) * b;
+  return static_cast<std::uint64_t>(p) ^ static_cast<std::uint64_t>(p >> 64);
+}
+
+inline std::uint64_t read_u64(unsigned char const* const p) noexcept
+{
+  std::uint64_t retval;
+  std::memcpy(&retval, p, sizeof retval);
+  return retval;
+}
+
+//
+// hash_bytes(p, n, seed)
+//
+// A fast 64-bit hash of the bytes [p,p+n) in the style of wyhash: 16 bytes
+// are absorbed per multiply-fold (mum()) step.
+//
+inline std::uint64_t hash_bytes(
+  void const* const data,
+  std::size_t const n,
+  std::uint64_t const seed = 0
+) noexcept
+{
+  constexpr std::uint64_t p0 = 0xa0761d6478bd642fULL;
+  constexpr std::uint64_t p1 = 0xe7037ed1a0b428dbULL;
+  constexpr std::uint64_t p2 = 0x8ebc6af09c88c6e3ULL;
+  constexpr std::uint64_t p3 = 0x589965cc75374cc3ULL;
+
+  auto const* p = static_cast<unsigned char const*>(data);
+  std::uint64_t h = seed ^ mum(seed ^ p0, n ^ p1);
+  std::size_t i = n;
+  for (; i >= 16; i -= 16, p += 16)
+    h = mum(read_u64(p) ^ p1, read_u64(p+8) ^ h);
+  if (i >= 8)
+  {
+    h = mum(read_u64(p) ^ p2, h ^ p3);
+    i -= 8;
+    p += 8;
+  }
+  if (i != 0)
+  {
+    std::uint64_t tail{};
+    std::memcpy(&tail, p, i);
+    h = mum(tail ^ p3, h ^ p0);
+  }
+  return mum(h ^ p0, n ^ p2);
+}
+
+} // namespace detail
+
+//=============================================================================
+
+//
+// fitness_cache
+// class
+//
+// A bounded, concurrent map from individuals (by a 64-bit hash of their
+// contents) to fitness values so duplicate individuals (common once a
+// population converges) are only evaluated once.
+//
+// The table is open addressed: a key's slots are the ways of one bucket (two
+// cache lines) chosen by the key's hash. When a bucket is full, a slot
+// is evicted using CLOCK: each slot has a reference bit set by every hit and
+// the bucket's hand (a shared counter) sweeps the bucket clearing reference
+// bits until it finds an unreferenced slot to replace.
+//
+// There is no lock: each slot is protected by its own sequence lock (seqlock)
+// so any number of threads can find() and insert() concurrently. A reader
+// that overlaps a writer of the same slot treats it as a miss, and a writer
+// finding another writer in a slot skips the insertion (it is only a cache).
+//
+// NOTE: Only the 64-bit hash (which includes the length) is stored, i.e.,
+//       distinct individuals with equal hashes (probability about 2^-64
+//       per pair) would share a fitness value.
+//
+class fitness_cache
+{
+public:
+  static constexpr std::size_t ways = 4;
+
+private:
+  struct slot
+  {
+    std::atomic<std::uint64_t> seq{};  // odd while being written
+    std::atomic<std::uint64_t> key{};  // 0 means empty
+    std::atomic<std::uint64_t> value{};
+  };
+
+  struct alignas(128) bucket
+  {
+    std::array<slot, ways> slots;
+    std::array<std::atomic<std::uint8_t>, ways> referenced{};
+    std::atomic<std::uint8_t> hand{};
+  };
+
+  // Hit/miss counters are striped (by key) over their own cache lines so
+  // threads do not all contend on one counter...
+  struct alignas(64) counters
+  {
+    std::atomic<std::uint64_t> hits{};
+    std::atomic<std::uint64_t> misses{};
+  };
+  static constexpr std::size_t nstripes = 16;
+
+  std::size_t mask_{};
+  std::unique_ptr<bucket[]> buckets_;
+  std::unique_ptr<counters[]> counters_;
+
+  static std::uint64_t nonzero(std::uint64_t const key) noexcept
+  {
+    return key != 0 ? key : 1;
+  }
+
+  bucket& bucket_for(std::uint64_t const key) const noexcept
+  {
+    // NOTE: The low bits pick the counter stripe...
+    return buckets_[(key >> 8) & mask_];
+  }
+
+  counters& stripe(std::uint64_t const key) const noexcept
+  {
+    return counters_[key % nstripes];
+  }
+
+  // Reads s's (key, value) if no write overlaps...
+  static std::optional<std::pair<std::uint64_t,std::uint64_t>> read(
+    slot const& s) noexcept
+  {
+    using namespace std;
+    uint64_t const seq1 = s.seq.load(memory_order_acquire);
+    if (seq1 & 1)
+      return nullopt;
+    uint64_t const k = s.key.load(memory_order_relaxed);
+    uint64_t const v = s.value.load(memory_order_relaxed);
+    atomic_thread_fence(memory_order_acquire);
+    if (s.seq.load(memory_order_relaxed) != seq1)
+      return nullopt;
+    return pair{ k, v };
+  }
+
+  // Writes (key, value) to slot i of b unless another thread is writing
+  // it...
+  static void write(bucket& b, std::size_t const i, std::uint64_t const key,
+    std::uint64_t const value) noexcept
+  {
+    using namespace std;
+    slot& s = b.slots[i];
+    uint64_t seq = s.seq.load(memory_order_relaxed);
+    if ((seq & 1) ||
+      !s.seq.compare_exchange_strong(seq, seq+1, memory_order_relaxed))
+      return;
+    atomic_thread_fence(memory_order_release);
+    s.key.store(key, memory_order_relaxed);
+    s.value.store(value, memory_order_relaxed);
+    b.referenced[i].store(0, memory_order_relaxed);
+    s.seq.store(seq+2, memory_order_release);
+  }
+
+public:
+  // Constructs a cache holding at least capacity entries (rounded up to a
+  // power of two).
+  explicit fitness_cache(std::size_t const capacity = std::size_t{1} << 16) :
+    mask_{std::bit_ceil(std::max(capacity / ways, std::size_t{1})) - 1},
+    buckets_{std::make_unique<bucket[]>(mask_+1)},
+    counters_{std::make_unique<counters[]>(nstripes)}
+  {
+  }
+
+  // Returns the hash of individual used as its key: the bytes of a
+  // contiguous range of elements without padding bits (e.g., char) are
+  // hashed directly, otherwise each element's std::hash is.
+  template <std::ranges::input_range Individual>
+  static std::uint64_t hash(Individual const& individual)
+  {
+    using namespace std;
+    using value_type = ranges::range_value_t<Individual>;
+    if constexpr(
+      ranges::contiguous_range<Individual> &&
+      ranges::sized_range<Individual> &&
+      has_unique_object_representations_v<value_type>
+    )
+      return detail::hash_bytes(ranges::data(individual),
+        ranges::size(individual) * sizeof(value_type));
+    else
+    {
+      uint64_t h{}, n{};
+      for (auto const& e : individual)
+      {
+        h = detail::mum(h ^ 0xa0761d6478bd642fULL,
+          static_cast<uint64_t>(std::hash<value_type>{}(e)) ^ ++n);
+      }
+      return detail::mum(h ^ 0xe7037ed1a0b428dbULL, n);
+    }
+  }
+
+  std::size_t capacity() const noexcept { return (mask_+1) * ways; }
+
+  // Returns the value stored for key (if any), counting a hit or a miss.
+  std::optional<std::size_t> find(std::uint64_t key) noexcept
+  {
+    using namespace std;
+    key = nonzero(key);
+    bucket& b = bucket_for(key);
+    for (size_t i{}; i != ways; ++i)
+      if (auto const kv = read(b.slots[i]); kv && kv->first == key)
+      {
+        // NOTE: Only writing an unset bit avoids dirtying the cache line...
+        if (b.referenced[i].load(memory_order_relaxed) == 0)
+          b.referenced[i].store(1, memory_order_relaxed);
+        stripe(key).hits.fetch_add(1, memory_order_relaxed);
+        return static_cast<size_t>(kv->second);
+      }
+    stripe(key).misses.fetch_add(1, memory_order_relaxed);
+    return nullopt;
+  }
+
+  // Stores value for key, evicting another entry (using CLOCK) if key's
+  // bucket is full.
+  void insert(std::uint64_t key, std::size_t const value) noexcept
+  {
+    using namespace std;
+    key = nonzero(key);
+    bucket& b = bucket_for(key);
+
+    // Update key's slot or fill an empty one...
+    for (size_t i{}; i != ways; ++i)
+    {
+      auto const kv = read(b.slots[i]);
+      if (kv && (kv->first == key || kv->first == 0))
+      {
+        write(b, i, key, value);
+        return;
+      }
+    }
+
+    // Evict: advance the hand, giving referenced slots a second chance...
+    for (size_t k{}; k != 2*ways; ++k)
+    {
+      size_t const i = b.hand.fetch_add(1, memory_order_relaxed) % ways;
+      if (b.referenced[i].exchange(0, memory_order_relaxed) == 0)
+      {
+        write(b, i, key, value);
+        return;
+      }
+    }
+  }
+
+  // Returns the fitness of individual: the cached value if there is one,
+  // otherwise compute(individual) which is then cached.
+  template <std::ranges::input_range Individual, typename Compute>
+  requires std::invocable<Compute&, Individual const&>
+  std::size_t get_or_compute(Individual const& individual, Compute&& compute)
+  {
+    std::uint64_t const key = hash(individual);
+    if (auto const cached = find(key))
+      return *cached;
+    std::size_t const retval = std::invoke(compute, individual);
+    insert(key, retval);
+    return retval;
+  }
+
+  std::uint64_t hits() const noexcept
+  {
+    std::uint64_t retval{};
+    for (std::size_t i{}; i != nstripes; ++i)
+      retval += counters_[i].hits.load(std::memory_order_relaxed);
+    return retval;
+  }
+
+  std::uint64_t misses() const noexcept
+  {
+    std::uint64_t retval{};
+    for (std::size_t i{}; i != nstripes; ++i)
+      retval += counters_[i].misses.load(std::memory_order_relaxed);
+    return retval;
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_fitness_cache_hpp_
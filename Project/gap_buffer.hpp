@@ -0,0 +1,361 @@
+#ifndef uwindsor_2023w_comp3400_project_gap_buffer_hpp_
+#define uwindsor_2023w_comp3400_project_gap_buffer_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// gap_buffer<T>
+// class template
+//
+// A sequence of T (e.g., a variable-length individual) stored in one array
+// with an unused "gap" at the cursor:
+//
+//   [ elements [0,cursor()) | gap | elements [cursor(),size()) ]
+//
+// Inserting or erasing at the cursor is O(1) (amortized, for insertion) since
+// only the gap's bounds change. Inserting or erasing elsewhere first moves
+// the cursor there which moves (with one memmove) only the elements between
+// the old and the new cursor positions. So a sequence of edits at increasing
+// positions (e.g., mutate_indel()) costs O(size() + edits) in total instead
+// of the O(size() * edits) of a std::vector or a std::string.
+//
+// A gap_buffer is a sized random-access range (element i is at array index i
+// if i < cursor(), otherwise at i + the gap's length) with push_back() so it
+// satisfies the range concepts levenshtein(), mutate(), crossover(),
+// beyond_project::crossover() (as a parent or through std::back_inserter), and
+// evolver require.
+//
+// NOTE: As with std::vector, insert() and erase() invalidate all iterators
+//       (but return a valid one).
+//
+template <typename T>
+requires std::is_trivially_copyable_v<T> && std::default_initializable<T>
+class gap_buffer
+{
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = T const&;
+
+private:
+  std::vector<T> buffer_;
+  size_type gap_first_{};  // == cursor()
+  size_type gap_last_{};
+
+  size_type gap_size() const noexcept { return gap_last_ - gap_first_; }
+
+  size_type physical(size_type const i) const noexcept
+  {
+    return i < gap_first_ ? i : i + gap_size();
+  }
+
+  // Moves the gap so it starts at index pos (<= size())...
+  void move_gap(size_type const pos) noexcept
+  {
+    if (pos < gap_first_)
+    {
+      size_type const n = gap_first_ - pos;
+      std::memmove(buffer_.data() + gap_last_ - n, buffer_.data() + pos,
+        n*sizeof(T));
+      gap_first_ -= n;
+      gap_last_ -= n;
+    }
+    else if (pos > gap_first_)
+    {
+      size_type const n = pos - gap_first_;
+      std::memmove(buffer_.data() + gap_first_, buffer_.data() + gap_last_,
+        n*sizeof(T));
+      gap_first_ += n;
+      gap_last_ += n;
+    }
+  }
+
+  // Ensures the gap has at least n elements (keeping its position)...
+  void grow_gap(size_type const n)
+  {
+    if (gap_size() >= n)
+      return;
+    size_type const tail = buffer_.size() - gap_last_;
+    size_type const new_capacity =
+      std::max({ 2*buffer_.size(), size() + n, size_type{16} });
+    std::vector<T> grown(new_capacity);
+    if (gap_first_ != 0)
+      std::memcpy(grown.data(), buffer_.data(), gap_first_*sizeof(T));
+    if (tail != 0)
+      std::memcpy(grown.data() + new_capacity - tail,
+        buffer_.data() + gap_last_, tail*sizeof(T));
+    buffer_ = std::move(grown);
+    gap_last_ = new_capacity - tail;
+  }
+
+  template <bool Const>
+  class basic_iterator
+  {
+  private:
+    using buffer_type =
+      std::conditional_t<Const, gap_buffer const, gap_buffer>;
+
+    buffer_type* buffer_{};
+    size_type index_{};
+
+  public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, T const*, T*>;
+    using reference = std::conditional_t<Const, T const&, T&>;
+
+    basic_iterator() = default;
+    basic_iterator(buffer_type* const buffer, size_type const index)
+      noexcept :
+      buffer_{buffer}, index_{index}
+    {
+    }
+
+    // Allows iterator to const_iterator conversions...
+    basic_iterator(basic_iterator<!Const> const& i) noexcept
+    requires Const :
+      buffer_{i.buffer_}, index_{i.index_}
+    {
+    }
+
+    // The index of the element this refers to.
+    size_type index() const noexcept { return index_; }
+
+    reference operator*() const noexcept { return (*buffer_)[index_]; }
+    pointer operator->() const noexcept { return &**this; }
+
+    reference operator[](difference_type const n) const noexcept
+    {
+      return *(*this + n);
+    }
+
+    basic_iterator& operator++() noexcept
+    {
+      ++index_;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept
+    {
+      auto retval = *this;
+      ++*this;
+      return retval;
+    }
+
+    basic_iterator& operator--() noexcept
+    {
+      --index_;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept
+    {
+      auto retval = *this;
+      --*this;
+      return retval;
+    }
+
+    basic_iterator& operator+=(difference_type const n) noexcept
+    {
+      index_ += static_cast<size_type>(n);
+      return *this;
+    }
+    basic_iterator& operator-=(difference_type const n) noexcept
+    {
+      return *this += -n;
+    }
+
+    friend basic_iterator operator+(basic_iterator i,
+      difference_type const n) noexcept
+    {
+      return i += n;
+    }
+    friend basic_iterator operator+(difference_type const n,
+      basic_iterator i) noexcept
+    {
+      return i += n;
+    }
+    friend basic_iterator operator-(basic_iterator i,
+      difference_type const n) noexcept
+    {
+      return i -= n;
+    }
+    friend difference_type operator-(basic_iterator const& a,
+      basic_iterator const& b) noexcept
+    {
+      return static_cast<difference_type>(a.index_ - b.index_);
+    }
+
+    friend bool operator==(basic_iterator const& a,
+      basic_iterator const& b) noexcept
+    {
+      return a.index_ == b.index_;
+    }
+    friend std::strong_ordering operator<=>(basic_iterator const& a,
+      basic_iterator const& b) noexcept
+    {
+      return a.index_ <=> b.index_;
+    }
+
+    friend class basic_iterator<!Const>;
+  };
+
+public:
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  gap_buffer() = default;
+
+  gap_buffer(size_type const count, T const& value) :
+    buffer_(count, value),
+    gap_first_{count},
+    gap_last_{count}
+  {
+  }
+
+  template <std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
+  requires std::convertible_to<std::iter_reference_t<Iter>, T>
+  gap_buffer(Iter first, Sentinel last)
+  {
+    if constexpr(std::sized_sentinel_for<Sentinel, Iter>)
+      buffer_.reserve(static_cast<size_type>(last - first));
+    for (; first != last; ++first)
+      buffer_.push_back(*first);
+    gap_first_ = gap_last_ = buffer_.size();
+  }
+
+  gap_buffer(std::initializer_list<T> const il) :
+    gap_buffer(il.begin(), il.end())
+  {
+  }
+
+  size_type size() const noexcept { return buffer_.size() - gap_size(); }
+  bool empty() const noexcept { return size() == 0; }
+  size_type capacity() const noexcept { return buffer_.size(); }
+
+  // The index where the gap is, i.e., where insertion and erasure are O(1).
+  size_type cursor() const noexcept { return gap_first_; }
+
+  void reserve(size_type const n)
+  {
+    if (n > size())
+      grow_gap(n - size());
+  }
+
+  void clear() noexcept
+  {
+    gap_first_ = 0;
+    gap_last_ = buffer_.size();
+  }
+
+  T& operator[](size_type const i) noexcept
+  {
+    return buffer_[physical(i)];
+  }
+  T const& operator[](size_type const i) const noexcept
+  {
+    return buffer_[physical(i)];
+  }
+
+  T& front() noexcept { return (*this)[0]; }
+  T const& front() const noexcept { return (*this)[0]; }
+  T& back() noexcept { return (*this)[size()-1]; }
+  T const& back() const noexcept { return (*this)[size()-1]; }
+
+  // Inserts value before pos returning an iterator to the inserted element.
+  iterator insert(const_iterator const pos, T const& value)
+  {
+    size_type const i = pos.index();
+    // NOTE: value may refer to an element so it is copied before any
+    //       element is moved...
+    T const copy = value;
+    move_gap(i);
+    grow_gap(1);
+    buffer_[gap_first_++] = copy;
+    return { this, i };
+  }
+
+  // Inserts [first,last) before pos returning an iterator to the first
+  // inserted element.
+  template <std::forward_iterator Iter, std::sentinel_for<Iter> Sentinel>
+  requires std::convertible_to<std::iter_reference_t<Iter>, T>
+  iterator insert(const_iterator const pos, Iter first, Sentinel const last)
+  {
+    size_type const i = pos.index();
+    size_type const n =
+      static_cast<size_type>(std::ranges::distance(first, last));
+    std::vector<T> const copy(first, std::ranges::next(first, last));
+    move_gap(i);
+    grow_gap(n);
+    if (n != 0)
+      std::memcpy(buffer_.data() + gap_first_, copy.data(), n*sizeof(T));
+    gap_first_ += n;
+    return { this, i };
+  }
+
+  // Erases the element at pos returning an iterator to the element after it.
+  iterator erase(const_iterator const pos) noexcept
+  {
+    size_type const i = pos.index();
+    move_gap(i);
+    ++gap_last_;
+    return { this, i };
+  }
+
+  // Erases [first,last) returning an iterator to the element after them.
+  iterator erase(const_iterator const first, const_iterator const last)
+    noexcept
+  {
+    size_type const i = first.index();
+    move_gap(i);
+    gap_last_ += last.index() - i;
+    return { this, i };
+  }
+
+  void push_back(T const& value) { insert(cend(), value); }
+  void pop_back() noexcept { erase(cend()-1); }
+
+  iterator begin() noexcept { return { this, 0 }; }
+  iterator end() noexcept { return { this, size() }; }
+  const_iterator begin() const noexcept { return { this, 0 }; }
+  const_iterator end() const noexcept { return { this, size() }; }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  friend bool operator==(gap_buffer const& a, gap_buffer const& b) noexcept
+  {
+    return std::ranges::equal(a, b);
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_gap_buffer_hpp_
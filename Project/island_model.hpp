@@ -0,0 +1,318 @@
+#ifndef uwindsor_2023w_comp3400_project_island_model_hpp_
+#define uwindsor_2023w_comp3400_project_island_model_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <ranges>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "evolver.hpp"
+#include "spsc_queue.hpp"
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// migration_topology
+// enum class
+//
+// Where an island's emigrants go:
+//   * ring: island i always sends to island (i+1) % islands, or,
+//   * random: each migration picks a uniformly random other island.
+//
+enum class migration_topology : unsigned char { ring, random };
+
+//
+// island_options
+// class
+//
+// The parameters of an island_model (in addition to each island's
+// evolver_options):
+//   * islands is the number of islands (each evolved by its own thread),
+//   * migration_interval is the number of generations between migrations,
+//   * migrants is the number of an island's fittest individuals sent at
+//     each migration,
+//   * topology is where migrants are sent, and,
+//   * queue_capacity is the capacity of each island-to-island queue
+//     (migrants that do not fit are dropped).
+//
+struct island_options
+{
+  std::size_t islands = std::max(std::thread::hardware_concurrency(), 1U);
+  std::size_t migration_interval = 20;
+  std::size_t migrants = 2;
+  migration_topology topology = migration_topology::ring;
+  std::size_t queue_capacity = 64;
+};
+
+//=============================================================================
+
+//
+// island_model<Individual, Selection, Fitness, Mutator>
+// class template
+//
+// N sub-populations ("islands") each evolved by an evolver on its own thread.
+// Every migration_interval generations an island sends copies of its fittest
+// individuals to another island which replace that island's least fit
+// individuals (see evolver::immigrate()).
+//
+// Islands never wait for each other: migrants travel through lock-free
+// single-producer/single-consumer queues (one per ordered pair of islands
+// that can communicate) and an island takes whatever has arrived at the
+// start of each of its generations.
+//
+// Island i's evolver is seeded with options.seed + i. Since islands run
+// concurrently, which migrants arrive when depends on thread scheduling.
+//
+template <
+  typename Individual = std::string,
+  typename Selection = binary_tournament_selection,
+  typename Fitness = levenshtein_fitness,
+  typename Mutator = stateless_char_mutator
+>
+class island_model
+{
+public:
+  using evolver_type = evolver<Individual, Selection, Fitness, Mutator>;
+
+private:
+  island_options island_options_;
+  std::vector<std::unique_ptr<evolver_type>> islands_;
+
+  // queues_[src*islands+dst] carries migrants from island src to island dst
+  // (nullptr if src never sends to dst)
+  std::vector<std::unique_ptr<spsc_queue<Individual>>> queues_;
+
+  double seconds_{};
+
+  std::size_t num_islands() const noexcept { return islands_.size(); }
+
+  spsc_queue<Individual>* queue(std::size_t const src, std::size_t const dst)
+  {
+    return queues_[src*num_islands() + dst].get();
+  }
+
+  // Evolves island i until stop is set or done(island's stats) is true...
+  template <typename Terminate>
+  void run_island(
+    std::size_t const i,
+    Terminate done,
+    std::atomic<bool>& stop
+  )
+  {
+    using namespace std;
+
+    size_t const n = num_islands();
+    evolver_type& ev = *islands_[i];
+    mt19937_64 urbg(ev.options().seed ^ 0x9E3779B97F4A7C15ULL);
+    uniform_int_distribution<size_t> other(1, n > 1 ? n-1 : 1);
+
+    vector<Individual> migrants;
+    Individual migrant;
+    while (!stop.load(memory_order_relaxed))
+    {
+      if (done(ev.stats()))
+      {
+        stop.store(true, memory_order_relaxed);
+        break;
+      }
+
+      // Take in whatever migrants have arrived...
+      migrants.clear();
+      for (size_t src{}; src != n; ++src)
+        if (auto* const q = queue(src, i))
+          while (q->try_pop(migrant))
+            migrants.push_back(std::move(migrant));
+      if (!migrants.empty())
+        ev.immigrate(migrants);
+
+      ev.step();
+
+      // Send copies of the fittest individuals...
+      size_t const interval = island_options_.migration_interval;
+      if (n > 1 && ev.stats().generation % interval == 0)
+      {
+        size_t const dst =
+          island_options_.topology == migration_topology::ring
+            ? (i+1) % n
+            : (i + other(urbg)) % n
+        ;
+        migrants.clear();
+        ev.fittest(island_options_.migrants, back_inserter(migrants));
+        for (auto& m : migrants)
+          if (!queue(i, dst)->try_push(std::move(m)))
+            break;
+      }
+    }
+  }
+
+public:
+  template <std::ranges::input_range Target>
+  island_model(
+    Target const& target,
+    evolver_options const& options,
+    island_options const& islands,
+    Selection selection = {},
+    Fitness fitness = {},
+    Mutator mutator = {}
+  ) :
+    island_options_{islands}
+  {
+    island_options_.islands =
+      std::max<std::size_t>(island_options_.islands, 1);
+    island_options_.migration_interval =
+      std::max<std::size_t>(island_options_.migration_interval, 1);
+
+    std::size_t const n = island_options_.islands;
+    islands_.reserve(n);
+    for (std::size_t i{}; i != n; ++i)
+    {
+      evolver_options o = options;
+      o.seed = options.seed + i;
+      islands_.push_back(std::make_unique<evolver_type>(
+        target, o, selection, fitness, mutator
+      ));
+    }
+
+    queues_.resize(n*n);
+    for (std::size_t src{}; src != n; ++src)
+      for (std::size_t dst{}; dst != n; ++dst)
+        if (
+          src != dst &&
+          (
+            island_options_.topology == migration_topology::random ||
+            dst == (src+1) % n
+          )
+        )
+          queues_[src*n + dst] = std::make_unique<spsc_queue<Individual>>(
+            island_options_.queue_capacity
+          );
+  }
+
+  island_options const& options() const noexcept { return island_options_; }
+  std::size_t size() const noexcept { return islands_.size(); }
+
+  evolver_type const& island(std::size_t const i) const
+  {
+    return *islands_[i];
+  }
+
+  // Returns the index of the island having the fittest individual.
+  std::size_t best_island() const
+  {
+    return static_cast<std::size_t>(std::ranges::min_element(islands_, {},
+      [](auto const& ev) { return ev->stats().best_fitness; }
+    ) - islands_.begin());
+  }
+
+  Individual const& best() const { return islands_[best_island()]->best(); }
+
+  // Returns the combined statistics of all islands: generation and
+  // evaluations are the totals over all islands, best_fitness and best_index
+  // are those of best_island(), and seconds is the wall-clock time spent in
+  // run().
+  evolver_stats stats() const
+  {
+    evolver_stats retval;
+    for (auto const& ev : islands_)
+    {
+      retval.generation += ev->stats().generation;
+      retval.evaluations += ev->stats().evaluations;
+    }
+    auto const& best = islands_[best_island()]->stats();
+    retval.best_fitness = best.best_fitness;
+    retval.best_index = best.best_index;
+    retval.seconds = seconds_;
+    return retval;
+  }
+
+  // Evolves all islands concurrently (island 0 on the calling thread) until
+  // done(stats) is true for any island's stats (checked before each of that
+  // island's generations). Returns stats().
+  //
+  // If an island throws an exception, all islands stop and the (first)
+  // exception is rethrown.
+  template <typename Terminate>
+  requires std::predicate<Terminate&, evolver_stats const&>
+  evolver_stats run(Terminate done)
+  {
+    using namespace std;
+
+    auto const start = chrono::steady_clock::now();
+
+    atomic<bool> stop{false};
+    mutex exception_mutex;
+    exception_ptr exception;
+    auto const island_main =
+      [&](size_t const i)
+      {
+        try
+        {
+          run_island(i, done, stop);
+        }
+        catch (...)
+        {
+          stop.store(true);
+          lock_guard lock(exception_mutex);
+          if (!exception)
+            exception = current_exception();
+        }
+      }
+    ;
+
+    vector<thread> threads;
+    try
+    {
+      threads.reserve(num_islands()-1);
+      for (size_t i{1}; i != num_islands(); ++i)
+        threads.emplace_back(island_main, i);
+    }
+    catch (...)
+    {
+      // NOTE: Destroying a joinable std::thread calls std::terminate() so the
+      //       threads already started are stopped and joined first...
+      stop.store(true);
+      for (auto& t : threads)
+        t.join();
+      throw;
+    }
+    island_main(0);
+    for (auto& t : threads)
+      t.join();
+
+    seconds_ += chrono::duration<double>(
+      chrono::steady_clock::now() - start
+    ).count();
+
+    if (exception)
+      rethrow_exception(exception);
+    return stats();
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_island_model_hpp_
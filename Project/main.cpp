@@ -1,6 +1,59 @@
+//=============================================================================
+
+#include <iomanip>
 #include <iostream>
+#include <string>
+
+#include "evolver.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  string const target{ "Methinks it is like a weasel. To be or not to be." };
 
-int main() {
-  std::cout << "Hello, World!" << std::endl;
-  return 0;
+  evolver_options options;
+  options.population_size = 2000;
+  options.mutation_rate = 0.01;
+  // NOTE: Without insertions and deletions every individual keeps the
+  //       target's length so a shifted character can trap the run, e.g.,
+  //       at "...To be or tnotto be." (fitness 2)...
+  options.indel_rate = 0.002;
+  options.crossover_rate = 0.7;
+  options.elites = 2;
+
+  evolver<string> ev(target, options);
+  cout << "target:\t" << quoted(target) << '\n';
+
+  auto const done =
+    [](evolver_stats const& s)
+    {
+      return stop_at_fitness{0}(s) || stop_after_generations{2000}(s);
+    }
+  ;
+  while (!done(ev.stats()))
+  {
+    auto const& s = ev.step();
+    if (s.generation % 50 == 0 || s.best_fitness == 0)
+      cout
+        << setw(6) << s.generation << '\t' << setw(3) << s.best_fitness << '\t'
+        << quoted(ev.best()) << '\n'
+      ;
+  }
+
+  auto const& s = ev.stats();
+  cout
+    << "generations:\t" << s.generation << '\n'
+    << "evaluations:\t" << s.evaluations << '\n'
+    << "best fitness:\t" << s.best_fitness << '\n'
+    << "target reached:\t" << boolalpha << (ev.best() == target) << '\n'
+    << fixed << setprecision(1)
+    << "generations/s:\t" << s.generations_per_second() << '\n'
+    << "evaluations/s:\t" << s.evaluations_per_second() << '\n'
+  ;
 }
+
+//=============================================================================
@@ -0,0 +1,179 @@
+#ifndef uwindsor_2023w_comp3400_project_philox_hpp_
+#define uwindsor_2023w_comp3400_project_philox_hpp_
+
+//=============================================================================
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// philox4x32
+// class
+//
+// The Philox4x32-10 counter-based random number generator (Salmon et al.,
+// "Parallel Random Numbers: As Easy as 1, 2, 3", SC 2011). It satisfies
+// std::uniform_random_bit_generator.
+//
+// Output block j of a stream is a bijection (10 rounds of multiply/xor) of
+// the 128-bit counter (j, generation, index) under the 64-bit key seed, i.e.,
+// there is no state other than (key, counter, position in block). This means:
+//   * a generator is constructed in O(1) for any (seed, generation, index),
+//     e.g., one generator per individual per generation, so
+//   * the random numbers an individual receives do not depend on which
+//     thread computes it or in which order, i.e., any parallel schedule
+//     produces bit-identical results, and,
+//   * discard(n) is O(1).
+//
+// Each (seed, generation, index) stream has 2^34 32-bit values.
+//
+class philox4x32
+{
+public:
+  using result_type = std::uint32_t;
+  using counter_type = std::array<std::uint32_t,4>;
+  using key_type = std::array<std::uint32_t,2>;
+
+  static constexpr std::size_t rounds = 10;
+
+private:
+  static constexpr std::uint32_t m0 = 0xD2511F53;
+  static constexpr std::uint32_t m1 = 0xCD9E8D57;
+  static constexpr std::uint32_t w0 = 0x9E3779B9;
+  static constexpr std::uint32_t w1 = 0xBB67AE85;
+
+  key_type key_{};
+  counter_type counter_{};  // counter_[0] is the block number
+  counter_type block_{};    // the output of the current block
+  unsigned next_{4};        // index into block_ (4 means none left)
+
+  static constexpr void mulhilo(std::uint32_t const a, std::uint32_t const b,
+    std::uint32_t& hi, std::uint32_t& lo) noexcept
+  {
+    std::uint64_t const p = std::uint64_t{a} * b;
+    hi = static_cast<std::uint32_t>(p >> 32);
+    lo = static_cast<std::uint32_t>(p);
+  }
+
+public:
+  // Returns the Philox4x32-10 bijection of counter under key.
+  static constexpr counter_type block(counter_type c, key_type k) noexcept
+  {
+    for (std::size_t r{}; r != rounds; ++r)
+    {
+      std::uint32_t hi0, lo0, hi1, lo1;
+      mulhilo(m0, c[0], hi0, lo0);
+      mulhilo(m1, c[2], hi1, lo1);
+      c = { hi1 ^ c[1] ^ k[0], lo1, hi0 ^ c[3] ^ k[1], lo0 };
+      k[0] += w0;
+      k[1] += w1;
+    }
+    return c;
+  }
+
+  static constexpr result_type min() noexcept { return 0; }
+  static constexpr result_type max() noexcept
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  constexpr philox4x32() noexcept = default;
+
+  // The stream of (seed, generation, index).
+  constexpr explicit philox4x32(
+    std::uint64_t const seed,
+    std::uint32_t const generation = 0,
+    std::uint64_t const index = 0
+  ) noexcept :
+    key_{
+      static_cast<std::uint32_t>(seed),
+      static_cast<std::uint32_t>(seed >> 32)
+    },
+    counter_{
+      0,
+      generation,
+      static_cast<std::uint32_t>(index),
+      static_cast<std::uint32_t>(index >> 32)
+    }
+  {
+  }
+
+  // The stream of an explicit key and counter (counter[0] is the first block).
+  constexpr philox4x32(key_type const& key, counter_type const& counter)
+    noexcept :
+    key_{key},
+    counter_{counter}
+  {
+  }
+
+  constexpr key_type const& key() const noexcept { return key_; }
+
+  constexpr result_type operator()() noexcept
+  {
+    if (next_ == 4)
+    {
+      block_ = block(counter_, key_);
+      ++counter_[0];
+      next_ = 0;
+    }
+    return block_[next_++];
+  }
+
+  // Skips the next n values in O(1) time.
+  constexpr void discard(unsigned long long n) noexcept
+  {
+    unsigned long long const buffered = 4 - next_;
+    if (n < buffered)
+    {
+      next_ += static_cast<unsigned>(n);
+      return;
+    }
+    n -= buffered;
+    counter_[0] += static_cast<std::uint32_t>(n / 4);
+    next_ = 4;
+    if (n % 4 != 0)
+    {
+      (*this)();
+      next_ = static_cast<unsigned>(n % 4);
+    }
+  }
+
+  friend constexpr bool operator==(philox4x32 const& a, philox4x32 const& b)
+    noexcept
+  {
+    // NOTE: Two generators in the same position compare equal even if one
+    //       has not computed its (identical) current block yet.
+    auto const position =
+      [](philox4x32 const& g)
+      {
+        counter_type c = g.counter_;
+        if (g.next_ != 4)
+          --c[0];
+        return std::pair{ c, g.next_ != 4 ? g.next_ : 0U };
+      }
+    ;
+    auto const [ac, an] = position(a);
+    auto const [bc, bn] = position(b);
+    return a.key_ == b.key_ && ac == bc && an == bn;
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_philox_hpp_
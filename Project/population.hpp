@@ -0,0 +1,409 @@
+#ifndef uwindsor_2023w_comp3400_project_population_hpp_
+#define uwindsor_2023w_comp3400_project_population_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// arena_population<T>
+// class template
+//
+// A population of individuals (sequences of T) stored in one contiguous,
+// cache-line-aligned arena instead of one heap allocation per individual:
+//   * individual i occupies the slot starting at byte i*stride() of the arena
+//     where stride() is capacity()*sizeof(T) rounded up to a multiple of the
+//     cache line size (so every individual starts on its own cache line),
+//   * the lengths of the individuals (each <= capacity()) are in an array,
+//     and,
+//   * the fitness values of the individuals are in a parallel array.
+//
+// Individuals are accessed as std::span<T> (or std::span<T const>) so they
+// satisfy the range concepts levenshtein(), mutate(), and
+// beyond_project::crossover() (as an output through span::begin()) require.
+// The population itself is a random-access range of such spans, e.g., it can
+// be passed to levenshtein_batch().
+//
+// NOTE: Since operator[] returns a span by value, use a named variable to
+//       pass an individual to a function taking a non-const lvalue
+//       reference, e.g., auto i = pop[3]; mutate(i, rate, m, urbg);
+//
+template <typename T>
+requires std::is_trivially_copyable_v<T> && std::default_initializable<T>
+class arena_population
+{
+public:
+  static constexpr std::size_t alignment = 64;
+
+  using value_type = std::span<T>;
+  using element_type = T;
+  using size_type = std::size_t;
+
+private:
+  struct aligned_delete
+  {
+    void operator()(T* p) const noexcept
+    {
+      ::operator delete(p, std::align_val_t{alignment});
+    }
+  };
+
+  size_type count_{};
+  size_type capacity_{};
+  size_type stride_{};  // in elements of T
+  std::unique_ptr<T[], aligned_delete> arena_;
+  std::vector<size_type> lengths_;
+  std::vector<size_type> fitness_;
+
+  static size_type stride_for(size_type const capacity) noexcept
+  {
+    size_type const bytes = capacity*sizeof(T);
+    size_type const line_bytes = (bytes + alignment-1) / alignment * alignment;
+    // NOTE: If sizeof(T) does not divide alignment, slots only stay
+    //       T-aligned (not cache-line-aligned)...
+    return (line_bytes + sizeof(T)-1) / sizeof(T);
+  }
+
+  static std::unique_ptr<T[], aligned_delete> allocate(size_type const n)
+  {
+    if (n == 0)
+      return nullptr;
+    T* const p = static_cast<T*>(
+      ::operator new(n*sizeof(T), std::align_val_t{alignment})
+    );
+    std::uninitialized_value_construct_n(p, n);
+    return std::unique_ptr<T[], aligned_delete>(p);
+  }
+
+  template <bool Const>
+  class basic_iterator
+  {
+  private:
+    using pointer_type = std::conditional_t<Const, T const*, T*>;
+
+    pointer_type slot_{};
+    size_type stride_{};
+    size_type const* length_{};
+
+  public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::span<std::conditional_t<Const, T const, T>>;
+    using difference_type = std::ptrdiff_t;
+
+    basic_iterator() = default;
+    basic_iterator(pointer_type const slot, size_type const stride,
+      size_type const* const length) noexcept :
+      slot_{slot}, stride_{stride}, length_{length}
+    {
+    }
+
+    // Allows iterator to const_iterator conversions...
+    basic_iterator(basic_iterator<!Const> const& i) noexcept
+    requires Const :
+      slot_{i.slot_}, stride_{i.stride_}, length_{i.length_}
+    {
+    }
+
+    value_type operator*() const noexcept { return { slot_, *length_ }; }
+
+    value_type operator[](difference_type const n) const noexcept
+    {
+      return *(*this + n);
+    }
+
+    basic_iterator& operator++() noexcept
+    {
+      slot_ += stride_;
+      ++length_;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept
+    {
+      auto retval = *this;
+      ++*this;
+      return retval;
+    }
+
+    basic_iterator& operator--() noexcept
+    {
+      slot_ -= stride_;
+      --length_;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept
+    {
+      auto retval = *this;
+      --*this;
+      return retval;
+    }
+
+    basic_iterator& operator+=(difference_type const n) noexcept
+    {
+      slot_ += n*static_cast<difference_type>(stride_);
+      length_ += n;
+      return *this;
+    }
+    basic_iterator& operator-=(difference_type const n) noexcept
+    {
+      return *this += -n;
+    }
+
+    friend basic_iterator operator+(basic_iterator i,
+      difference_type const n) noexcept
+    {
+      return i += n;
+    }
+    friend basic_iterator operator+(difference_type const n,
+      basic_iterator i) noexcept
+    {
+      return i += n;
+    }
+    friend basic_iterator operator-(basic_iterator i,
+      difference_type const n) noexcept
+    {
+      return i -= n;
+    }
+    friend difference_type operator-(basic_iterator const& a,
+      basic_iterator const& b) noexcept
+    {
+      return a.length_ - b.length_;
+    }
+
+    friend bool operator==(basic_iterator const& a,
+      basic_iterator const& b) noexcept
+    {
+      return a.length_ == b.length_;
+    }
+    friend std::strong_ordering operator<=>(basic_iterator const& a,
+      basic_iterator const& b) noexcept
+    {
+      return a.length_ <=> b.length_;
+    }
+
+    friend class basic_iterator<!Const>;
+  };
+
+public:
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  arena_population() = default;
+
+  // Constructs count individuals of length capacity with value-initialized
+  // elements and fitness values.
+  arena_population(size_type const count, size_type const capacity) :
+    count_{count},
+    capacity_{capacity},
+    stride_{stride_for(capacity)},
+    arena_{allocate(count*stride_)},
+    lengths_(count, capacity),
+    fitness_(count)
+  {
+  }
+
+  // Constructs a copy of the individuals in population (the capacity is the
+  // length of the longest individual).
+  template <std::ranges::forward_range Population>
+  requires
+    std::ranges::sized_range<Population> &&
+    std::ranges::forward_range<std::ranges::range_reference_t<Population>> &&
+    std::convertible_to<
+      std::ranges::range_value_t<std::ranges::range_reference_t<Population>>,
+      T
+    >
+  explicit arena_population(Population const& population) :
+    arena_population(
+      std::ranges::size(population),
+      [&]()
+      {
+        size_type retval{};
+        for (auto const& individual : population)
+          retval = std::max(retval,
+            static_cast<size_type>(std::ranges::distance(individual)));
+        return retval;
+      }()
+    )
+  {
+    size_type i{};
+    for (auto const& individual : population)
+      assign(i++, individual);
+  }
+
+  arena_population(arena_population const& other) :
+    count_{other.count_},
+    capacity_{other.capacity_},
+    stride_{other.stride_},
+    arena_{allocate(other.count_*other.stride_)},
+    lengths_(other.lengths_),
+    fitness_(other.fitness_)
+  {
+    if (count_*stride_ != 0)
+      std::memcpy(arena_.get(), other.arena_.get(), count_*stride_*sizeof(T));
+  }
+
+  arena_population& operator=(arena_population const& other)
+  {
+    if (this != &other)
+    {
+      arena_population copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  // NOTE: The moved-from population is left empty (with capacity 0)...
+  arena_population(arena_population&& other) noexcept :
+    count_{std::exchange(other.count_, 0)},
+    capacity_{std::exchange(other.capacity_, 0)},
+    stride_{std::exchange(other.stride_, 0)},
+    arena_{std::move(other.arena_)},
+    lengths_{std::exchange(other.lengths_, {})},
+    fitness_{std::exchange(other.fitness_, {})}
+  {
+  }
+
+  arena_population& operator=(arena_population&& other) noexcept
+  {
+    if (this != &other)
+    {
+      count_ = std::exchange(other.count_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+      stride_ = std::exchange(other.stride_, 0);
+      arena_ = std::move(other.arena_);
+      lengths_ = std::exchange(other.lengths_, {});
+      fitness_ = std::exchange(other.fitness_, {});
+    }
+    return *this;
+  }
+
+  size_type size() const noexcept { return count_; }
+  bool empty() const noexcept { return count_ == 0; }
+
+  // The maximum length of each individual.
+  size_type capacity() const noexcept { return capacity_; }
+
+  // The distance in elements of T between consecutive individuals.
+  size_type stride() const noexcept { return stride_; }
+
+  T* data() noexcept { return arena_.get(); }
+  T const* data() const noexcept { return arena_.get(); }
+
+  std::span<T> operator[](size_type const i) noexcept
+  {
+    return { arena_.get() + i*stride_, lengths_[i] };
+  }
+
+  std::span<T const> operator[](size_type const i) const noexcept
+  {
+    return { arena_.get() + i*stride_, lengths_[i] };
+  }
+
+  // Returns individual i's whole slot, i.e., capacity() elements.
+  std::span<T> slot(size_type const i) noexcept
+  {
+    return { arena_.get() + i*stride_, capacity_ };
+  }
+
+  // Sets the length of individual i (to at most capacity()). Returns the
+  // resized individual.
+  std::span<T> resize(size_type const i, size_type const length) noexcept
+  {
+    lengths_[i] = std::min(length, capacity_);
+    return (*this)[i];
+  }
+
+  // Copies the first (at most) capacity() elements of r into individual i.
+  // Returns the resulting individual.
+  template <std::ranges::input_range R>
+  requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+  std::span<T> assign(size_type const i, R&& r)
+  {
+    T* const first = arena_.get() + i*stride_;
+    T* last = first;
+    if constexpr(
+      std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+      std::same_as<std::ranges::range_value_t<R>, T>
+    )
+    {
+      size_type const n =
+        std::min(static_cast<size_type>(std::ranges::size(r)), capacity_);
+      if (n != 0)
+        std::memcpy(first, std::ranges::data(r), n*sizeof(T));
+      last = first + n;
+    }
+    else
+    {
+      auto it = std::ranges::begin(r);
+      auto const end = std::ranges::end(r);
+      for (; it != end && last != first + capacity_; ++it, ++last)
+        *last = *it;
+    }
+    lengths_[i] = static_cast<size_type>(last - first);
+    return (*this)[i];
+  }
+
+  // Copies individual src into individual dst (of this population).
+  void copy(size_type const dst, size_type const src) noexcept
+  {
+    if (dst != src && lengths_[src] != 0)
+      std::memcpy(arena_.get() + dst*stride_, arena_.get() + src*stride_,
+        lengths_[src]*sizeof(T));
+    lengths_[dst] = lengths_[src];
+  }
+
+  std::span<size_type const> lengths() const noexcept { return lengths_; }
+
+  // The fitness values of the individuals (fitness()[i] is individual i's).
+  std::span<size_type> fitness() noexcept { return fitness_; }
+  std::span<size_type const> fitness() const noexcept { return fitness_; }
+
+  iterator begin() noexcept
+  {
+    return { arena_.get(), stride_, lengths_.data() };
+  }
+  iterator end() noexcept
+  {
+    return begin() + static_cast<std::ptrdiff_t>(count_);
+  }
+  const_iterator begin() const noexcept
+  {
+    return { arena_.get(), stride_, lengths_.data() };
+  }
+  const_iterator end() const noexcept
+  {
+    return begin() + static_cast<std::ptrdiff_t>(count_);
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_population_hpp_
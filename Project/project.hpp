@@ -5,17 +5,33 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cctype>
+#include <cmath>
 #include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define UWINDSOR_2023W_COMP3400_X86_SIMD
+  #include <immintrin.h>
+#endif
+
 #include "utils.hpp"
+#include "population.hpp"
 
 //=============================================================================
 
@@ -55,47 +71,2298 @@ constexpr T const& min(T const& a, T const& b, Rest const&... rest)
 
 //=============================================================================
 
-// https://en.wikipedia.org/wiki/Levenshtein_distance#Iterative_with_two_matrix_rows
-template <typename StringA, typename StringB>
+//
+// levenshtein_workspace
+// class
+//
+// A levenshtein_workspace holds the scratch memory used by levenshtein() and
+// levenshtein_within(). Passing the same workspace to many calls means memory
+// is only (re)allocated when a call needs more than any earlier call did,
+// i.e., in steady state no call dynamically allocates any RAM.
+//
+// When no workspace is passed, a thread_local workspace is used.
+//
+// NOTE: A workspace must not be used by more than one thread at a time.
+//
+class levenshtein_workspace
+{
+private:
+  std::vector<std::uint16_t> cells16_;
+  std::vector<std::uint32_t> cells32_;
+  std::vector<std::uint64_t> cells64_;
+
+  template <typename T>
+  constexpr std::vector<T>& buffer() noexcept
+  {
+    if constexpr(std::same_as<T,std::uint16_t>)
+      return cells16_;
+    else if constexpr(std::same_as<T,std::uint32_t>)
+      return cells32_;
+    else
+    {
+      static_assert(std::same_as<T,std::uint64_t>);
+      return cells64_;
+    }
+  }
+
+public:
+  // Returns a pointer to at least n elements of T. The values of the elements
+  // are unspecified.
+  template <typename T>
+  requires
+    std::same_as<T,std::uint16_t> ||
+    std::same_as<T,std::uint32_t> ||
+    std::same_as<T,std::uint64_t>
+  constexpr T* storage(std::size_t const n)
+  {
+    auto& v = buffer<T>();
+    if (v.size() < n)
+      v.resize(n);
+    return v.data();
+  }
+};
+
+//=============================================================================
+
+//
+// Bit-parallel Levenshtein distance engine (Myers 1999 / Hyyrö 2003).
+//
+// The "detail" namespace holds definitions users should not use directly.
+// levenshtein() (here and in beyond_project.hpp) dispatches to these when
+// the range element types are byte-sized integers, e.g., char.
+//
+// The DP matrix columns (i.e., the pattern) are encoded as bit vectors of
+// vertical +1/-1 deltas so an entire column is advanced with a handful of
+// word-wide operations per text element:
+//   * if the pattern fits in 64 bits a single word is used, otherwise
+//   * the pattern is split into 64-bit blocks and the horizontal +1/-1
+//     carries are propagated from one block to the next.
+//
+// The results are identical to the two-row DP algorithm.
+//
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_bit_parallel_element_v =
+  std::is_integral_v<T> && sizeof(T) == 1
+;
+
+inline constexpr std::size_t bit_parallel_word_bits = 64;
+inline constexpr std::size_t bit_parallel_alphabet_size = 256;
+
+template <typename T>
+constexpr std::size_t bit_parallel_index(T const& t) noexcept
+{
+  return static_cast<unsigned char>(t);
+}
+
+constexpr std::size_t bit_parallel_num_words(std::size_t const m) noexcept
+{
+  return (m + bit_parallel_word_bits-1) / bit_parallel_word_bits;
+}
+
+//
+// The pattern's "peq" table holds, for each alphabet character, the bit
+// vector of the pattern positions equal to that character. It is stored
+// character-major so all nwords blocks of a character are adjacent, i.e.,
+// peq must point to bit_parallel_alphabet_size*nwords elements.
+//
+template <std::forward_iterator PatternIter, std::sentinel_for<PatternIter> PatternEnd>
+constexpr void bit_parallel_fill_peq(
+  PatternIter pfirst, PatternEnd const plast,
+  std::size_t const nwords,
+  std::uint64_t* const peq
+)
+{
+  using namespace std;
+  fill_n(peq, bit_parallel_alphabet_size*nwords, uint64_t{});
+  for (size_t i{}; pfirst != plast; ++pfirst, ++i)
+    peq[bit_parallel_index(*pfirst)*nwords + i/bit_parallel_word_bits] |=
+      uint64_t{1} << (i % bit_parallel_word_bits);
+}
+
+//
+// The vertical delta vectors and the current distance of a text scan. For
+// patterns longer than 64 elements vp and vn point to nwords blocks each.
+//
+struct bit_parallel_word_state
+{
+  std::uint64_t vp = ~std::uint64_t{};
+  std::uint64_t vn{};
+  std::size_t dist{};
+};
+
+struct bit_parallel_blocks_state
+{
+  std::uint64_t* vp{};
+  std::uint64_t* vn{};
+  std::size_t dist{};
+};
+
+// Advances state st by one text element whose pattern mask is x. The
+// pattern's last position is the bit set in last.
+constexpr void bit_parallel_word_step(
+  bit_parallel_word_state& st,
+  std::uint64_t const x,
+  std::uint64_t const last
+) noexcept
+{
+  std::uint64_t const d0 = (((x & st.vp) + st.vp) ^ st.vp) | x | st.vn;
+  std::uint64_t hp = st.vn | ~(d0 | st.vp);
+  std::uint64_t hn = d0 & st.vp;
+  st.dist += (hp & last) != 0;
+  st.dist -= (hn & last) != 0;
+  hp = (hp << 1) | 1;
+  hn <<= 1;
+  st.vp = hn | ~(d0 | hp);
+  st.vn = hp & d0;
+}
+
+// Advances state st by one text element whose pattern masks are eq[0..nwords).
+// The pattern's last position is the bit set in last of the last block.
+constexpr void bit_parallel_blocks_step(
+  bit_parallel_blocks_state& st,
+  std::uint64_t const* const eq,
+  std::size_t const nwords,
+  std::uint64_t const last
+) noexcept
+{
+  using namespace std;
+
+  uint64_t* const vp = st.vp;
+  uint64_t* const vn = st.vn;
+  uint64_t hp_carry{1};
+  uint64_t hn_carry{};
+  for (size_t w{}; w != nwords; ++w)
+  {
+    uint64_t const x = eq[w] | hn_carry;
+    uint64_t const d0 = (((x & vp[w]) + vp[w]) ^ vp[w]) | x | vn[w];
+    uint64_t hp = vn[w] | ~(d0 | vp[w]);
+    uint64_t hn = d0 & vp[w];
+
+    uint64_t const hp_carry_in = hp_carry;
+    uint64_t const hn_carry_in = hn_carry;
+    if (w+1 != nwords)
+    {
+      hp_carry = hp >> (bit_parallel_word_bits-1);
+      hn_carry = hn >> (bit_parallel_word_bits-1);
+    }
+    else
+    {
+      hp_carry = (hp & last) != 0;
+      hn_carry = (hn & last) != 0;
+    }
+
+    hp = (hp << 1) | hp_carry_in;
+    hn = (hn << 1) | hn_carry_in;
+    vp[w] = hn | ~(d0 | hp);
+    vn[w] = hp & d0;
+  }
+  st.dist += hp_carry;
+  st.dist -= hn_carry;
+}
+
+// Scans the text [tfirst,tlast) against a pattern of 1 <= m <= 64 elements.
+template <std::forward_iterator TextIter, std::sentinel_for<TextIter> TextEnd>
+constexpr std::size_t bit_parallel_word_scan(
+  std::uint64_t const* const peq, std::size_t const m,
+  TextIter tfirst, TextEnd const tlast
+)
+{
+  std::uint64_t const last = std::uint64_t{1} << (m-1);
+  bit_parallel_word_state st{.dist = m};
+  for (; tfirst != tlast; ++tfirst)
+    bit_parallel_word_step(st, peq[bit_parallel_index(*tfirst)], last);
+  return st.dist;
+}
+
+// Scans the text [tfirst,tlast) against a pattern of m >= 1 elements where
+// vpvn must point to 2*bit_parallel_num_words(m) elements.
+template <std::forward_iterator TextIter, std::sentinel_for<TextIter> TextEnd>
+constexpr std::size_t bit_parallel_blocks_scan(
+  std::uint64_t const* const peq, std::size_t const m,
+  TextIter tfirst, TextEnd const tlast,
+  std::uint64_t* const vpvn
+)
+{
+  using namespace std;
+
+  size_t const nwords = bit_parallel_num_words(m);
+  bit_parallel_blocks_state st{vpvn, vpvn+nwords, m};
+  fill_n(st.vp, nwords, ~uint64_t{});
+  fill_n(st.vn, nwords, uint64_t{});
+
+  uint64_t const last = uint64_t{1} << ((m-1) % bit_parallel_word_bits);
+  for (; tfirst != tlast; ++tfirst)
+    bit_parallel_blocks_step(
+      st, peq + bit_parallel_index(*tfirst)*nwords, nwords, last
+    );
+  return st.dist;
+}
+
+// Scans the text [tfirst,tlast) against a pattern of m >= 1 elements using
+// the single-word scan if possible. If m > 64 vpvn must point to
+// 2*bit_parallel_num_words(m) elements.
+template <std::forward_iterator TextIter, std::sentinel_for<TextIter> TextEnd>
+constexpr std::size_t bit_parallel_word_or_blocks_scan(
+  std::uint64_t const* const peq, std::size_t const m,
+  TextIter const tfirst, TextEnd const tlast,
+  std::uint64_t* const vpvn
+)
+{
+  if (m <= bit_parallel_word_bits)
+    return bit_parallel_word_scan(peq, m, tfirst, tlast);
+  else
+    return bit_parallel_blocks_scan(peq, m, tfirst, tlast, vpvn);
+}
+
+// The number of texts bit_parallel_scan_lanes() is used with.
+inline constexpr std::size_t bit_parallel_batch_lanes = 4;
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+//
+// Advances the four states st[0..4) over common elements of the byte texts
+// t[0..4) with each state in its own 64-bit AVX2 lane (i.e., the same steps
+// as bit_parallel_word_step()).
+//
+__attribute__((target("avx2")))
+inline void bit_parallel_word_scan4_avx2(
+  std::uint64_t const* const peq, std::uint64_t const last,
+  unsigned char const* const* const t, std::size_t const common,
+  bit_parallel_word_state* const st
+)
+{
+  __m256i vp = _mm256_set_epi64x(st[3].vp, st[2].vp, st[1].vp, st[0].vp);
+  __m256i vn = _mm256_set_epi64x(st[3].vn, st[2].vn, st[1].vn, st[0].vn);
+  __m256i dist = _mm256_set_epi64x(
+    st[3].dist, st[2].dist, st[1].dist, st[0].dist
+  );
+  __m256i const lastv = _mm256_set1_epi64x(last);
+  __m256i const ones = _mm256_set1_epi64x(-1);
+  __m256i const one = _mm256_set1_epi64x(1);
+
+  for (std::size_t i{}; i != common; ++i)
+  {
+    __m256i const x = _mm256_set_epi64x(
+      peq[t[3][i]], peq[t[2][i]], peq[t[1][i]], peq[t[0][i]]
+    );
+    __m256i const d0 = _mm256_or_si256(
+      _mm256_or_si256(
+        _mm256_xor_si256(_mm256_add_epi64(_mm256_and_si256(x, vp), vp), vp), 
+        x
+      ),
+      vn
+    );
+    __m256i hp = 
+      _mm256_or_si256(vn, _mm256_andnot_si256(_mm256_or_si256(d0, vp), ones));
+    __m256i hn = _mm256_and_si256(d0, vp);
+
+    // NOTE: _mm256_cmpeq_epi64() is -1 when the last bit is set...
+    dist = _mm256_sub_epi64(
+      dist, _mm256_cmpeq_epi64(_mm256_and_si256(hp, lastv), lastv)
+    );
+    dist = _mm256_add_epi64(
+      dist, _mm256_cmpeq_epi64(_mm256_and_si256(hn, lastv), lastv)
+    );
+
+    hp = _mm256_or_si256(_mm256_slli_epi64(hp, 1), one);
+    hn = _mm256_slli_epi64(hn, 1);
+    vp = _mm256_or_si256(hn, _mm256_andnot_si256(_mm256_or_si256(d0, hp), ones));
+    vn = _mm256_and_si256(hp, d0);
+  }
+
+  alignas(32) std::uint64_t vp_lanes[4];
+  alignas(32) std::uint64_t vn_lanes[4];
+  alignas(32) std::uint64_t dist_lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(vp_lanes), vp);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(vn_lanes), vn);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(dist_lanes), dist);
+  for (std::size_t l{}; l != 4; ++l)
+    st[l] = { vp_lanes[l], vn_lanes[l], dist_lanes[l] };
+}
+
+//
+// The same as bit_parallel_word_scan4_avx2() for patterns of more than 64
+// elements, i.e., bit_parallel_blocks_step() is done with each state in its
+// own 64-bit AVX2 lane. The lanes' blocks are kept interleaved in scratch
+// which must point to 8*nwords elements. When done, the blocks are copied
+// back into the states.
+//
+__attribute__((target("avx2")))
+inline void bit_parallel_blocks_scan4_avx2(
+  std::uint64_t const* const peq, std::size_t const nwords, 
+  std::uint64_t const last,
+  unsigned char const* const* const t, std::size_t const common,
+  bit_parallel_blocks_state* const st,
+  std::uint64_t* const scratch
+)
+{
+  std::uint64_t* const vps = scratch;
+  std::uint64_t* const vns = scratch + 4*nwords;
+  for (std::size_t w{}; w != nwords; ++w)
+    for (std::size_t l{}; l != 4; ++l)
+    {
+      vps[4*w+l] = st[l].vp[w];
+      vns[4*w+l] = st[l].vn[w];
+    }
+
+  __m256i dist = _mm256_set_epi64x(
+    st[3].dist, st[2].dist, st[1].dist, st[0].dist
+  );
+  __m256i const lastv = _mm256_set1_epi64x(last);
+  __m256i const ones = _mm256_set1_epi64x(-1);
+  __m256i const one = _mm256_set1_epi64x(1);
+
+  for (std::size_t i{}; i != common; ++i)
+  {
+    std::uint64_t const* const eq0 = peq + t[0][i]*nwords;
+    std::uint64_t const* const eq1 = peq + t[1][i]*nwords;
+    std::uint64_t const* const eq2 = peq + t[2][i]*nwords;
+    std::uint64_t const* const eq3 = peq + t[3][i]*nwords;
+
+    __m256i hp_carry = one;
+    __m256i hn_carry = _mm256_setzero_si256();
+    for (std::size_t w{}; w != nwords; ++w)
+    {
+      __m256i* const vpw = reinterpret_cast<__m256i*>(vps + 4*w);
+      __m256i* const vnw = reinterpret_cast<__m256i*>(vns + 4*w);
+      __m256i const vp = _mm256_loadu_si256(vpw);
+      __m256i const vn = _mm256_loadu_si256(vnw);
+
+      __m256i const x = _mm256_or_si256(
+        _mm256_set_epi64x(eq3[w], eq2[w], eq1[w], eq0[w]),
+        hn_carry
+      );
+      __m256i const d0 = _mm256_or_si256(
+        _mm256_or_si256(
+          _mm256_xor_si256(_mm256_add_epi64(_mm256_and_si256(x, vp), vp), vp),
+          x
+        ),
+        vn
+      );
+      __m256i hp = 
+        _mm256_or_si256(vn, _mm256_andnot_si256(_mm256_or_si256(d0, vp), ones));
+      __m256i hn = _mm256_and_si256(d0, vp);
+
+      __m256i const hp_carry_in = hp_carry;
+      __m256i const hn_carry_in = hn_carry;
+      if (w+1 != nwords)
+      {
+        hp_carry = _mm256_srli_epi64(hp, 63);
+        hn_carry = _mm256_srli_epi64(hn, 63);
+      }
+      else
+      {
+        hp_carry = _mm256_srli_epi64(
+          _mm256_cmpeq_epi64(_mm256_and_si256(hp, lastv), lastv), 63
+        );
+        hn_carry = _mm256_srli_epi64(
+          _mm256_cmpeq_epi64(_mm256_and_si256(hn, lastv), lastv), 63
+        );
+      }
+
+      hp = _mm256_or_si256(_mm256_slli_epi64(hp, 1), hp_carry_in);
+      hn = _mm256_or_si256(_mm256_slli_epi64(hn, 1), hn_carry_in);
+      _mm256_storeu_si256(
+        vpw, 
+        _mm256_or_si256(hn, _mm256_andnot_si256(_mm256_or_si256(d0, hp), ones))
+      );
+      _mm256_storeu_si256(vnw, _mm256_and_si256(hp, d0));
+    }
+    dist = _mm256_sub_epi64(_mm256_add_epi64(dist, hp_carry), hn_carry);
+  }
+
+  alignas(32) std::uint64_t dist_lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(dist_lanes), dist);
+  for (std::size_t l{}; l != 4; ++l)
+  {
+    for (std::size_t w{}; w != nwords; ++w)
+    {
+      st[l].vp[w] = vps[4*w+l];
+      st[l].vn[w] = vns[4*w+l];
+    }
+    st[l].dist = dist_lanes[l];
+  }
+}
+
+inline bool cpu_supports_avx2()
+{
+  static bool const retval = 
+    []() 
+    { 
+      __builtin_cpu_init(); 
+      return __builtin_cpu_supports("avx2") != 0; 
+    }()
+  ;
+  return retval;
+}
+
+#endif // #ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+//
+// Scans Lanes texts [tfirst[l],tlast[l]), each of at least common elements,
+// against the same pattern of m >= 1 elements writing the distances to
+// dist[l]. The texts are interleaved element-by-element for their common
+// length so the (otherwise serial) dependency chains of the scans overlap.
+// If Lanes is 4, the texts are contiguous, and the CPU supports AVX2, then
+// the common length is instead scanned with one AVX2 lane per text.
+// If m > 64, vpvn must point to 4*Lanes*bit_parallel_num_words(m) elements.
+//
+template <
+  std::size_t Lanes,
+  std::forward_iterator TextIter, std::sentinel_for<TextIter> TextEnd
+>
+constexpr void bit_parallel_scan_lanes(
+  std::uint64_t const* const peq, std::size_t const m,
+  std::array<TextIter,Lanes> tfirst, 
+  std::array<TextEnd,Lanes> const& tlast,
+  std::size_t const common,
+  std::uint64_t* const vpvn,
+  std::size_t* const dist
+)
+{
+  using namespace std;
+
+  if (m <= bit_parallel_word_bits)
+  {
+    uint64_t const last = uint64_t{1} << (m-1);
+    array<bit_parallel_word_state,Lanes> st;
+    st.fill(bit_parallel_word_state{.dist = m});
+    size_t i{};
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+    // Contiguous texts can be processed with one AVX2 lane per text...
+    if constexpr(Lanes == 4 && contiguous_iterator<TextIter>)
+    {
+      if (!is_constant_evaluated() && cpu_supports_avx2())
+      {
+        array<unsigned char const*,Lanes> t;
+        for (size_t l{}; l != Lanes; ++l)
+          t[l] = reinterpret_cast<unsigned char const*>(to_address(tfirst[l]));
+        bit_parallel_word_scan4_avx2(peq, last, t.data(), common, st.data());
+        for (size_t l{}; l != Lanes; ++l)
+          tfirst[l] += static_cast<iter_difference_t<TextIter>>(common);
+        i = common;
+      }
+    }
+#endif
+    for (; i != common; ++i)
+      for (size_t l{}; l != Lanes; ++l)
+      {
+        bit_parallel_word_step(st[l], peq[bit_parallel_index(*tfirst[l])], last);
+        ++tfirst[l];
+      }
+    for (size_t l{}; l != Lanes; ++l)
+    {
+      for (; tfirst[l] != tlast[l]; ++tfirst[l])
+        bit_parallel_word_step(st[l], peq[bit_parallel_index(*tfirst[l])], last);
+      dist[l] = st[l].dist;
+    }
+  }
+  else
+  {
+    size_t const nwords = bit_parallel_num_words(m);
+    uint64_t const last = uint64_t{1} << ((m-1) % bit_parallel_word_bits);
+    array<bit_parallel_blocks_state,Lanes> st;
+    for (size_t l{}; l != Lanes; ++l)
+    {
+      st[l] = { vpvn + 2*l*nwords, vpvn + (2*l+1)*nwords, m };
+      fill_n(st[l].vp, nwords, ~uint64_t{});
+      fill_n(st[l].vn, nwords, uint64_t{});
+    }
+    size_t i{};
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+    if constexpr(Lanes == 4 && contiguous_iterator<TextIter>)
+    {
+      if (!is_constant_evaluated() && cpu_supports_avx2())
+      {
+        array<unsigned char const*,Lanes> t;
+        for (size_t l{}; l != Lanes; ++l)
+          t[l] = reinterpret_cast<unsigned char const*>(to_address(tfirst[l]));
+        bit_parallel_blocks_scan4_avx2(
+          peq, nwords, last, t.data(), common, st.data(), 
+          vpvn + 2*Lanes*nwords
+        );
+        for (size_t l{}; l != Lanes; ++l)
+          tfirst[l] += static_cast<iter_difference_t<TextIter>>(common);
+        i = common;
+      }
+    }
+#endif
+    for (; i != common; ++i)
+      for (size_t l{}; l != Lanes; ++l)
+      {
+        bit_parallel_blocks_step(
+          st[l], peq + bit_parallel_index(*tfirst[l])*nwords, nwords, last
+        );
+        ++tfirst[l];
+      }
+    for (size_t l{}; l != Lanes; ++l)
+    {
+      for (; tfirst[l] != tlast[l]; ++tfirst[l])
+        bit_parallel_blocks_step(
+          st[l], peq + bit_parallel_index(*tfirst[l])*nwords, nwords, last
+        );
+      dist[l] = st[l].dist;
+    }
+  }
+}
+
+// Pattern [pfirst,plast) must have 1 <= m <= 64 elements.
+template <
+  std::forward_iterator PatternIter, std::sentinel_for<PatternIter> PatternEnd,
+  std::forward_iterator TextIter, std::sentinel_for<TextIter> TextEnd
+>
+constexpr std::size_t levenshtein_bit_parallel_word(
+  PatternIter pfirst, PatternEnd const plast, std::size_t const m,
+  TextIter tfirst, TextEnd const tlast
+)
+{
+  std::array<std::uint64_t, bit_parallel_alphabet_size> peq{};
+  bit_parallel_fill_peq(pfirst, plast, 1, peq.data());
+  return bit_parallel_word_scan(peq.data(), m, tfirst, tlast);
+}
+
+// Pattern [pfirst,plast) must have m >= 1 elements and words must point to
+// (bit_parallel_alphabet_size+2)*bit_parallel_num_words(m) elements.
+template <
+  std::forward_iterator PatternIter, std::sentinel_for<PatternIter> PatternEnd,
+  std::forward_iterator TextIter, std::sentinel_for<TextIter> TextEnd
+>
+constexpr std::size_t levenshtein_bit_parallel_blocks(
+  PatternIter pfirst, PatternEnd const plast, std::size_t const m,
+  TextIter tfirst, TextEnd const tlast,
+  std::uint64_t* const words
+)
+{
+  std::size_t const nwords = bit_parallel_num_words(m);
+  bit_parallel_fill_peq(pfirst, plast, nwords, words);
+  return bit_parallel_blocks_scan(
+    words, m, tfirst, tlast, 
+    words + bit_parallel_alphabet_size*nwords
+  );
+}
+
+// Computes the Levenshtein distance of pattern (of size m) and text (of size
+// n). The pattern should be the shorter of the two ranges since the work done
+// is proportional to ceil(m/64)*n.
+template <std::ranges::forward_range Pattern, std::ranges::forward_range Text>
+constexpr std::size_t levenshtein_bit_parallel(
+  Pattern const& pattern, std::size_t const m,
+  Text const& text, std::size_t const n,
+  levenshtein_workspace& ws
+)
+{
+  namespace rng = std::ranges;
+  if (m == 0)
+    return n;
+  else if (m <= bit_parallel_word_bits)
+    return levenshtein_bit_parallel_word(
+      rng::cbegin(pattern), rng::cend(pattern), m,
+      rng::cbegin(text), rng::cend(text)
+    );
+  else
+    return levenshtein_bit_parallel_blocks(
+      rng::cbegin(pattern), rng::cend(pattern), m,
+      rng::cbegin(text), rng::cend(text),
+      ws.storage<std::uint64_t>(
+        (bit_parallel_alphabet_size+2) * bit_parallel_num_words(m)
+      )
+    );
+}
+
+//
+// Two-row DP Levenshtein distance where the inner range has isize elements
+// and prev_row and cur_row each point to isize+1 cells. Cell must be able
+// to hold the longest range's size plus one.
+//
+template <
+  typename Cell,
+  std::forward_iterator OuterIter, std::sentinel_for<OuterIter> OuterEnd,
+  std::forward_iterator InnerIter, std::sentinel_for<InnerIter> InnerEnd
+>
+constexpr std::size_t levenshtein_two_rows(
+  OuterIter ofirst, OuterEnd const olast,
+  InnerIter const ifirst, InnerEnd const ilast, std::size_t const isize,
+  Cell* prev_row, Cell* cur_row
+)
+{
+  using namespace std;
+
+  iota(prev_row, prev_row+isize+1, Cell{});
+
+  Cell i_plus_one{1};
+  for (; ofirst != olast; ++ofirst, ++i_plus_one)
+  {
+    cur_row[0] = i_plus_one;
+    Cell* cur = cur_row;
+    Cell const* prev = prev_row;
+    for (auto j = ifirst; j != ilast; ++j, ++prev, ++cur)
+    {
+      Cell const insert_cost = cur[0]+1;
+      Cell const subst_cost = prev[0] + (*ofirst != *j);
+      Cell const del_cost = prev[1]+1;
+      cur[1] = min(del_cost, insert_cost, subst_cost);
+    }
+    swap(prev_row, cur_row);
+  }
+  return prev_row[isize];
+}
+
+//
+// Computes cur_row (DP row i where i_plus_one is i+1) from prev_row given the
+// outer range's element x and the inner range [inner,inner+isize). Both rows
+// have isize+1 cells.
+//
+template <typename Cell, typename T>
+constexpr void levenshtein_next_row(
+  Cell const* const prev_row, Cell* const cur_row, Cell const i_plus_one,
+  T const& x, T const* const inner, std::size_t const isize
+)
+{
+  cur_row[0] = i_plus_one;
+  for (std::size_t j{}; j != isize; ++j)
+  {
+    Cell const insert_cost = cur_row[j]+1;
+    Cell const subst_cost = prev_row[j] + (x != inner[j]);
+    Cell const del_cost = prev_row[j+1]+1;
+    cur_row[j+1] = min(del_cost, insert_cost, subst_cost);
+  }
+}
+
+// Runs levenshtein_two_rows() with the narrowest cell type that can hold
+// max_size+1.
+template <std::ranges::forward_range Outer, std::ranges::forward_range Inner>
+constexpr std::size_t levenshtein_narrowest_two_rows(
+  Outer const& outer,
+  Inner const& inner, std::size_t const isize,
+  std::size_t const max_size,
+  levenshtein_workspace& ws
+)
+{
+  using namespace std;
+
+  auto const run =
+    [&]<typename Cell>(Cell* const rows)
+    {
+      return levenshtein_two_rows(
+        ranges::cbegin(outer), ranges::cend(outer),
+        ranges::cbegin(inner), ranges::cend(inner), isize,
+        rows, rows+isize+1
+      );
+    }
+  ;
+
+  if (max_size < numeric_limits<uint16_t>::max())
+    return run(ws.storage<uint16_t>(2*(isize+1)));
+  else if (max_size < numeric_limits<uint32_t>::max())
+    return run(ws.storage<uint32_t>(2*(isize+1)));
+  else
+    return run(ws.storage<uint64_t>(2*(isize+1)));
+}
+
+//
+// Anti-diagonal SIMD Levenshtein distance kernel.
+//
+// Every cell on anti-diagonal d (i.e., cells (i,j) with i+j == d) only
+// depends on cells of anti-diagonals d-1 and d-2 so all cells of a diagonal
+// can be computed at once with SIMD instructions. To make the loads of b
+// contiguous (since j decreases as i increases along a diagonal) b is stored
+// reversed.
+//
+// Both ranges are first widened to std::uint32_t so a single kernel handles
+// 8-, 16-, and 32-bit elements. The kernel used (AVX2, SSE4.1, or scalar) is
+// chosen at run-time according to what the CPU supports.
+//
+// levenshtein_impl() uses this kernel for long contiguous ranges of 16- and
+// 32-bit integral elements. (Byte-sized elements use the bit-parallel
+// engine which is faster still.)
+//
+
+template <typename T>
+inline constexpr bool is_antidiagonal_element_v =
+  std::is_integral_v<T> && 
+  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4)
+;
+
+// The smallest range size the kernel is used for by levenshtein_impl().
+inline constexpr std::size_t antidiagonal_min_size = 64;
+
+//
+// Computes count cells of a diagonal where for 0 <= t < count:
+//
+//   cur[t] = min(min(prev1[t], prev1[t+1])+1, prev2[t]+(a[t] != rb[t]))
+//
+// i.e., prev1 and prev2 point to the cells (i-1,j) and (i-1,j-1) of the first
+// cell (i,j) computed.
+//
+using antidiagonal_step_fn = void (*)(
+  std::uint32_t* cur,
+  std::uint32_t const* prev1,
+  std::uint32_t const* prev2,
+  std::uint32_t const* a,
+  std::uint32_t const* rb,
+  std::size_t count
+);
+
+inline void antidiagonal_step_scalar(
+  std::uint32_t* const cur,
+  std::uint32_t const* const prev1,
+  std::uint32_t const* const prev2,
+  std::uint32_t const* const a,
+  std::uint32_t const* const rb,
+  std::size_t const count
+)
+{
+  for (std::size_t t{}; t != count; ++t)
+  {
+    std::uint32_t const del_insert_cost = min(prev1[t], prev1[t+1])+1;
+    std::uint32_t const subst_cost = prev2[t] + (a[t] != rb[t]);
+    cur[t] = min(del_insert_cost, subst_cost);
+  }
+}
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+// NOTE: _mm*_cmpeq_epi32() is -1 for equal elements so prev2+1+eq is the
+//       substitution cost.
+
+__attribute__((target("sse4.1")))
+inline void antidiagonal_step_sse41(
+  std::uint32_t* const cur,
+  std::uint32_t const* const prev1,
+  std::uint32_t const* const prev2,
+  std::uint32_t const* const a,
+  std::uint32_t const* const rb,
+  std::size_t const count
+)
+{
+  constexpr std::size_t lanes = 4;
+  __m128i const one = _mm_set1_epi32(1);
+  std::size_t t{};
+  for (; t+lanes <= count; t += lanes)
+  {
+    __m128i const p1_0 = 
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(prev1+t));
+    __m128i const p1_1 = 
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(prev1+t+1));
+    __m128i const p2 = 
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(prev2+t));
+    __m128i const av = 
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(a+t));
+    __m128i const bv = 
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(rb+t));
+
+    __m128i const del_insert_cost = 
+      _mm_add_epi32(_mm_min_epu32(p1_0, p1_1), one);
+    __m128i const subst_cost = 
+      _mm_add_epi32(_mm_add_epi32(p2, one), _mm_cmpeq_epi32(av, bv));
+    _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(cur+t),
+      _mm_min_epu32(del_insert_cost, subst_cost)
+    );
+  }
+  antidiagonal_step_scalar(cur+t, prev1+t, prev2+t, a+t, rb+t, count-t);
+}
+
+__attribute__((target("avx2")))
+inline void antidiagonal_step_avx2(
+  std::uint32_t* const cur,
+  std::uint32_t const* const prev1,
+  std::uint32_t const* const prev2,
+  std::uint32_t const* const a,
+  std::uint32_t const* const rb,
+  std::size_t const count
+)
+{
+  constexpr std::size_t lanes = 8;
+  __m256i const one = _mm256_set1_epi32(1);
+  std::size_t t{};
+  for (; t+lanes <= count; t += lanes)
+  {
+    __m256i const p1_0 = 
+      _mm256_loadu_si256(reinterpret_cast<__m256i const*>(prev1+t));
+    __m256i const p1_1 = 
+      _mm256_loadu_si256(reinterpret_cast<__m256i const*>(prev1+t+1));
+    __m256i const p2 = 
+      _mm256_loadu_si256(reinterpret_cast<__m256i const*>(prev2+t));
+    __m256i const av = 
+      _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a+t));
+    __m256i const bv = 
+      _mm256_loadu_si256(reinterpret_cast<__m256i const*>(rb+t));
+
+    __m256i const del_insert_cost = 
+      _mm256_add_epi32(_mm256_min_epu32(p1_0, p1_1), one);
+    __m256i const subst_cost = 
+      _mm256_add_epi32(_mm256_add_epi32(p2, one), _mm256_cmpeq_epi32(av, bv));
+    _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(cur+t),
+      _mm256_min_epu32(del_insert_cost, subst_cost)
+    );
+  }
+  antidiagonal_step_scalar(cur+t, prev1+t, prev2+t, a+t, rb+t, count-t);
+}
+
+#endif // #ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+// Returns the best antidiagonal_step_fn the CPU supports.
+inline antidiagonal_step_fn antidiagonal_step()
+{
+  static antidiagonal_step_fn const step =
+    []() -> antidiagonal_step_fn
+    {
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+        return &antidiagonal_step_avx2;
+      if (__builtin_cpu_supports("sse4.1"))
+        return &antidiagonal_step_sse41;
+#endif
+      return &antidiagonal_step_scalar;
+    }()
+  ;
+  return step;
+}
+
+//
+// Computes the Levenshtein distance of a (of size n) and b (of size m) given
+// b reversed in rb and diags pointing to 3*(n+1) cells.
+//
+inline std::size_t levenshtein_antidiagonal(
+  std::uint32_t const* const a, std::size_t const n,
+  std::uint32_t const* const rb, std::size_t const m,
+  std::uint32_t* const diags,
+  antidiagonal_step_fn const step
+)
+{
+  // Diagonals are indexed by i. Diagonal 0 is the cell (0,0)...
+  std::uint32_t* prev2 = diags;
+  std::uint32_t* prev1 = prev2 + n+1;
+  std::uint32_t* cur = prev1 + n+1;
+  prev1[0] = 0;
+
+  for (std::size_t d{1}; d <= n+m; ++d)
+  {
+    // Boundary cells (0,d) and (d,0)...
+    if (d <= m)
+      cur[0] = static_cast<std::uint32_t>(d);
+    if (d <= n)
+      cur[d] = static_cast<std::uint32_t>(d);
+
+    // Interior cells (i,d-i) for i in [max(1,d-m),min(n,d-1)]...
+    std::size_t const ifirst = (d > m) ? d-m : 1;
+    std::size_t const ilast = (d-1 < n) ? d-1 : n;
+    if (ifirst <= ilast)
+      step(
+        cur+ifirst, prev1+ifirst-1, prev2+ifirst-1,
+        a+ifirst-1, rb+(m-d+ifirst),
+        ilast-ifirst+1
+      );
+
+    std::uint32_t* const old_prev2 = prev2;
+    prev2 = prev1;
+    prev1 = cur;
+    cur = old_prev2;
+  }
+  return prev1[n];
+}
+
+//
+// levenshtein_simd(a,b,ws)
+//
+// Widens contiguous ranges a and b to std::uint32_t, with the shorter
+// range being the one indexing the diagonals, and then runs the anti-diagonal
+// kernel. Both sizes must be less than the maximum std::uint32_t value.
+//
+template <std::ranges::contiguous_range StringA, std::ranges::contiguous_range StringB>
 requires
   std::ranges::sized_range<StringA> &&
   std::ranges::sized_range<StringB> &&
-  std::ranges::random_access_range<StringA> &&
-  std::ranges::random_access_range<StringB> &&
+  is_antidiagonal_element_v<std::ranges::range_value_t<StringA>> &&
   std::same_as<
     std::ranges::range_value_t<StringA>,
     std::ranges::range_value_t<StringB>
   >
-std::size_t levenshtein(StringA const& a, StringB const& b)
+std::size_t levenshtein_simd(
+  StringA const& a, StringB const& b, 
+  levenshtein_workspace& ws
+)
 {
   using namespace std;
+  using value_type = ranges::range_value_t<StringA>;
+  auto const widen = 
+    [](value_type const& v) 
+    { 
+      return static_cast<uint32_t>(static_cast<make_unsigned_t<value_type>>(v)); 
+    }
+  ;
+
+  auto const run =
+    [&](auto const& shorter, size_t const n, auto const& longer, size_t const m)
+    {
+      uint32_t* const a32 = ws.storage<uint32_t>(n + m + 3*(n+1));
+      uint32_t* const rb32 = a32 + n;
+      uint32_t* const diags = rb32 + m;
+      ranges::transform(shorter, a32, widen);
+      ranges::transform(longer, reverse_iterator{rb32+m}, widen);
+      return levenshtein_antidiagonal(a32, n, rb32, m, diags, antidiagonal_step());
+    }
+  ;
 
-  auto const bsize = ranges::size(b);
+  size_t const asize = ranges::size(a);
+  size_t const bsize = ranges::size(b);
+  if (asize < bsize)
+    return run(a, asize, b, bsize);
+  else
+    return run(b, bsize, a, asize);
+}
+
+//
+// levenshtein_impl(a,asize,b,bsize,ws)
+//
+// Computes the Levenshtein distance of a and b whose sizes are asize and bsize
+// respectively. This is shared by all levenshtein() overloads (including the
+// ones in beyond_project.hpp).
+//   * byte-sized elements use the bit-parallel engine with the shorter range
+//     as the pattern
+//   * long contiguous ranges of 16- and 32-bit integral elements use the
+//     anti-diagonal SIMD kernel
+//   * otherwise the two-row DP is used with the shorter range as the inner
+//     dimension (so the rows are as small as possible)
+//
+template <std::ranges::forward_range StringA, std::ranges::forward_range StringB>
+constexpr std::size_t levenshtein_impl(
+  StringA const& a, std::size_t const asize,
+  StringB const& b, std::size_t const bsize,
+  levenshtein_workspace& ws
+)
+{
+  if constexpr(is_bit_parallel_element_v<std::ranges::range_value_t<StringA>>)
+  {
+    if (asize < bsize)
+      return levenshtein_bit_parallel(a, asize, b, bsize, ws);
+    else
+      return levenshtein_bit_parallel(b, bsize, a, asize, ws);
+  }
+  else
+  {
+    if constexpr(
+      is_antidiagonal_element_v<std::ranges::range_value_t<StringA>> &&
+      std::ranges::contiguous_range<StringA> &&
+      std::ranges::contiguous_range<StringB> &&
+      std::ranges::sized_range<StringA> &&
+      std::ranges::sized_range<StringB>
+    )
+    {
+      if (
+        !std::is_constant_evaluated() &&
+        min(asize, bsize) >= antidiagonal_min_size &&
+        std::max(asize, bsize) < std::numeric_limits<std::uint32_t>::max()
+      )
+        return levenshtein_simd(a, b, ws);
+    }
+
+    if (asize < bsize)
+      return levenshtein_narrowest_two_rows(b, a, asize, bsize, ws);
+    else
+      return levenshtein_narrowest_two_rows(a, b, bsize, asize, ws);
+  }
+}
+
+// Returns this thread's default levenshtein_workspace.
+inline levenshtein_workspace& thread_levenshtein_workspace()
+{
+  thread_local levenshtein_workspace ws;
+  return ws;
+}
+
+} // namespace detail
+
+//=============================================================================
+
+// https://en.wikipedia.org/wiki/Levenshtein_distance#Iterative_with_two_matrix_rows
+//   * ws provides the scratch memory, see levenshtein_workspace.
+//   * The shorter range is always used as the inner dimension and the DP cells
+//     are the narrowest of std::uint16_t, std::uint32_t, and std::uint64_t
+//     that can hold the result.
+template <typename StringA, typename StringB>
+requires
+  std::ranges::sized_range<StringA> &&
+  std::ranges::sized_range<StringB> &&
+  std::ranges::random_access_range<StringA> &&
+  std::ranges::random_access_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  >
+std::size_t levenshtein(
+  StringA const& a,
+  StringB const& b,
+  levenshtein_workspace& ws
+)
+{
+  return detail::levenshtein_impl(
+    a, std::ranges::size(a),
+    b, std::ranges::size(b),
+    ws
+  );
+}
+
+// Same as levenshtein(a,b,ws) using this thread's workspace.
+template <typename StringA, typename StringB>
+requires
+  std::ranges::sized_range<StringA> &&
+  std::ranges::sized_range<StringB> &&
+  std::ranges::random_access_range<StringA> &&
+  std::ranges::random_access_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  >
+std::size_t levenshtein(StringA const& a, StringB const& b)
+{
+  return levenshtein(a, b, detail::thread_levenshtein_workspace());
+}
+
+//
+// levenshtein(a,b) for fixed-size ranges.
+//
+// If a and/or b has its size known at compile-time (see fixed_extent_v) then
+// this overload is used. The fixed-size range is the inner dimension (if both
+// are, the shorter one is) so:
+//   * the DP rows are std::array objects on the stack (i.e., there is no
+//     dynamic memory allocation),
+//   * the inner loop has a compile-time trip count (so the compiler can
+//     unroll it for small sizes), and,
+//   * byte-sized elements with an inner size <= 64 use the single-word
+//     bit-parallel engine (whose table is also a std::array).
+// This overload is constexpr so it can be used in static_assert.
+//
+namespace detail {
+
+template <std::size_t N, typename Outer, typename Inner>
+constexpr std::size_t levenshtein_fixed(Outer const& outer, Inner const& inner)
+{
+  using namespace std;
+
+  if constexpr(N == 0)
+    return static_cast<size_t>(ranges::size(outer));
+  else if constexpr(
+    is_bit_parallel_element_v<ranges::range_value_t<Inner>> &&
+    N <= bit_parallel_word_bits
+  )
+    return levenshtein_bit_parallel_word(
+      ranges::cbegin(inner), ranges::cend(inner), N,
+      ranges::cbegin(outer), ranges::cend(outer)
+    );
+  else
+  {
+    array<array<size_t,N+1>,2> rows{};
+    iota(rows[0].begin(), rows[0].end(), size_t{});
+
+    auto const inner_iter = ranges::cbegin(inner);
+    size_t i{};
+    for (auto const& x : outer)
+    {
+      auto const& prev_row = rows[i % 2];
+      auto& cur_row = rows[(i+1) % 2];
+      cur_row[0] = i+1;
+      for (size_t j{}; j != N; ++j)
+      {
+        size_t const insert_cost = cur_row[j]+1;
+        size_t const subst_cost = prev_row[j] + (x != inner_iter[j]);
+        size_t const del_cost = prev_row[j+1]+1;
+        cur_row[j+1] = min(del_cost, insert_cost, subst_cost);
+      }
+      ++i;
+    }
+    return rows[i % 2][N];
+  }
+}
+
+} // namespace detail
+
+template <typename StringA, typename StringB>
+requires
+  std::ranges::sized_range<StringA> &&
+  std::ranges::sized_range<StringB> &&
+  std::ranges::random_access_range<StringA> &&
+  std::ranges::random_access_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  > &&
+  (fixed_size_range<StringA> || fixed_size_range<StringB>)
+constexpr std::size_t levenshtein(StringA const& a, StringB const& b)
+{
+  constexpr std::size_t aextent = fixed_extent_v<std::remove_cvref_t<StringA>>;
+  constexpr std::size_t bextent = fixed_extent_v<std::remove_cvref_t<StringB>>;
+
+  // NOTE: std::dynamic_extent is the largest std::size_t value.
+  if constexpr(bextent <= aextent)
+    return detail::levenshtein_fixed<bextent>(a, b);
+  else
+    return detail::levenshtein_fixed<aextent>(b, a);
+}
+
+//=============================================================================
+
+//
+// levenshtein_within(a,b,k)
+//
+// Returns the Levenshtein distance of a and b if such is <= k, otherwise
+// std::nullopt is returned.
+//
+// Only the diagonal band of cells (i,j) with |i-j| <= k is computed since
+// any cell outside of the band has a value > k. The computation is abandoned
+// as soon as every cell in a row exceeds k. This makes the cost O(k*n)
+// instead of O(n*m).
+//
+// NOTE: Within the band, cells are stored at index j-i+k+1 so row i-1's
+//       cells (i-1,j-1) and (i-1,j) are at the same index and the one after
+//       it respectively. Indices 0 and 2k+2 are always "infinity" (i.e., k+1).
+//
+template <typename StringA, typename StringB>
+requires
+  std::ranges::sized_range<StringA> &&
+  std::ranges::sized_range<StringB> &&
+  std::ranges::random_access_range<StringA> &&
+  std::ranges::random_access_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  >
+std::optional<std::size_t> levenshtein_within(
+  StringA const& a,
+  StringB const& b,
+  std::size_t k,
+  levenshtein_workspace& ws
+)
+{
+  using namespace std;
+
+  size_t const asize = ranges::size(a);
+  size_t const bsize = ranges::size(b);
+
+  // The length difference is a lower bound on the distance...
+  if ((asize < bsize ? bsize-asize : asize-bsize) > k)
+    return nullopt;
+
+  // The distance never exceeds the longest length...
+  k = min(k, std::max(asize, bsize));
+
+  // Short byte-sized ranges are cheaper to compute in full with the
+  // single-word bit-parallel engine...
+  if constexpr(detail::is_bit_parallel_element_v<ranges::range_value_t<StringA>>)
+  {
+    if (min(asize, bsize) <= detail::bit_parallel_word_bits)
+    {
+      size_t const dist = (asize < bsize)
+        ? detail::levenshtein_bit_parallel(a, asize, b, bsize, ws)
+        : detail::levenshtein_bit_parallel(b, bsize, a, asize, ws)
+      ;
+      return dist <= k ? optional<size_t>{dist} : nullopt;
+    }
+  }
+
+  size_t const inf = k+1;
+  size_t const width = 2*k+3;
+  uint64_t* prev_row = ws.storage<uint64_t>(2*width);
+  uint64_t* cur_row = prev_row + width;
+  fill_n(prev_row, 2*width, inf);
+
+  // Row 0: cell (0,j) == j for j in [0,min(k,bsize)]...
+  for (size_t j{}; j <= min(k, bsize); ++j)
+    prev_row[j+k+1] = j;
+
+  auto a_iter = ranges::cbegin(a);
+  auto b_iter = ranges::cbegin(b);
+  for (size_t i{1}; i <= asize; ++i)
+  {
+    // Band columns are [i-k,i+k] intersected with [0,bsize]...
+    size_t const jfirst = (i > k) ? i-k : 0;
+    size_t const jlast = min(i+k, bsize);
+
+    size_t row_min = inf;
+    for (size_t idx{1}; idx+1 != width; ++idx)
+    {
+      // Cell (i,j) where j == i-k-1+idx. To avoid negative values jk,
+      // i.e., j+k, is used instead of j...
+      size_t const jk = i+idx-1;
+      if (jk < jfirst+k || jk > jlast+k)
+        cur_row[idx] = inf;
+      else if (jk == k)
+        cur_row[idx] = min(i, inf);
+      else
+      {
+        size_t const insert_cost = cur_row[idx-1]+1;
+        size_t const subst_cost =
+          prev_row[idx] + (a_iter[i-1] != b_iter[jk-k-1]);
+        size_t const del_cost = prev_row[idx+1]+1;
+        cur_row[idx] = min(del_cost, insert_cost, subst_cost, inf);
+      }
+      row_min = min<size_t>(row_min, cur_row[idx]);
+    }
+
+    if (row_min > k)
+      return nullopt;
+    swap(prev_row, cur_row);
+  }
+
+  size_t const dist = prev_row[bsize+k+1-asize];
+  return dist <= k ? optional<size_t>{dist} : nullopt;
+}
+
+// Same as levenshtein_within(a,b,k,ws) using this thread's workspace.
+template <typename StringA, typename StringB>
+requires
+  std::ranges::sized_range<StringA> &&
+  std::ranges::sized_range<StringB> &&
+  std::ranges::random_access_range<StringA> &&
+  std::ranges::random_access_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  >
+std::optional<std::size_t> levenshtein_within(
+  StringA const& a,
+  StringB const& b,
+  std::size_t const k
+)
+{
+  return levenshtein_within(a, b, k, detail::thread_levenshtein_workspace());
+}
+
+//=============================================================================
+
+//
+// levenshtein_batch(target, population, out, nthreads = 1)
+//
+// Writes levenshtein(target,individual) for each individual in population to
+// out (in order) and returns the resulting output iterator.
+//
+// The target is preprocessed once:
+//   * for byte-sized elements its bit-parallel match masks are built once
+//     and every individual is streamed through them, otherwise
+//   * each individual is computed with the same (per-thread) workspace.
+//
+// If nthreads > 1, population is a sized random-access range, and out is a
+// random-access iterator, then the population is split into nthreads
+// contiguous chunks with each chunk computed by its own std::thread (the
+// calling thread computes the first chunk). Otherwise the calling thread
+// computes everything.
+//
+template <
+  std::ranges::forward_range Target,
+  std::ranges::forward_range Population,
+  typename OutIter
+>
+requires
+  std::ranges::forward_range<std::ranges::range_reference_t<Population>> &&
+  std::same_as<
+    std::ranges::range_value_t<Target>,
+    std::ranges::range_value_t<std::ranges::range_value_t<Population>>
+  > &&
+  std::output_iterator<OutIter, std::size_t>
+OutIter levenshtein_batch(
+  Target const& target,
+  Population const& population,
+  OutIter out,
+  std::size_t const nthreads = 1
+)
+{
+  using namespace std;
+  using value_type = ranges::range_value_t<Target>;
+  constexpr bool bit_parallel = detail::is_bit_parallel_element_v<value_type>;
+
+  size_t const m = static_cast<size_t>(ranges::distance(target));
+  size_t const nwords = detail::bit_parallel_num_words(m);
+
+  vector<uint64_t> peq;
+  if constexpr(bit_parallel)
+  {
+    peq.resize(detail::bit_parallel_alphabet_size*nwords);
+    detail::bit_parallel_fill_peq(
+      ranges::cbegin(target), ranges::cend(target), nwords, peq.data()
+    );
+  }
+
+  auto const distance =
+    [&](auto const& individual, levenshtein_workspace& ws) -> size_t
+    {
+      size_t const n = static_cast<size_t>(ranges::distance(individual));
+      if constexpr(bit_parallel)
+      {
+        if (m == 0)
+          return n;
+        else
+          return detail::bit_parallel_word_or_blocks_scan(
+            peq.data(), m, ranges::cbegin(individual), ranges::cend(individual),
+            ws.storage<uint64_t>(2*nwords)
+          );
+      }
+      else
+        return detail::levenshtein_impl(target, m, individual, n, ws);
+    }
+  ;
+
+  auto const run =
+    [&](auto first, auto const last, auto o)
+    {
+      levenshtein_workspace& ws = detail::thread_levenshtein_workspace();
+
+      // Stream batch_lanes individuals at a time through the target's masks...
+      if constexpr(
+        bit_parallel && 
+        is_lvalue_reference_v<ranges::range_reference_t<Population>>
+      )
+      {
+        constexpr size_t lanes = detail::bit_parallel_batch_lanes;
+        using individual_type = 
+          remove_cvref_t<ranges::range_reference_t<Population>>;
+        using text_iter = decltype(ranges::cbegin(declval<individual_type&>()));
+        using text_end = decltype(ranges::cend(declval<individual_type&>()));
+
+        if (m != 0)
+        {
+          uint64_t* const vpvn = (m > detail::bit_parallel_word_bits)
+            ? ws.storage<uint64_t>(4*lanes*nwords)
+            : nullptr
+          ;
+          for (;;)
+          {
+            array<text_iter,lanes> tfirst;
+            array<text_end,lanes> tlast;
+            size_t common = numeric_limits<size_t>::max();
+            size_t l{};
+            for (; l != lanes && first != last; ++l, ++first)
+            {
+              tfirst[l] = ranges::cbegin(*first);
+              tlast[l] = ranges::cend(*first);
+              common = min(common, static_cast<size_t>(ranges::distance(*first)));
+            }
+            if (l != lanes)
+            {
+              // Too few individuals are left to fill every lane...
+              for (size_t i{}; i != l; ++i)
+              {
+                *o = detail::bit_parallel_word_or_blocks_scan(
+                  peq.data(), m, tfirst[i], tlast[i], vpvn
+                );
+                ++o;
+              }
+              return o;
+            }
+
+            array<size_t,lanes> dist;
+            detail::bit_parallel_scan_lanes<lanes>(
+              peq.data(), m, tfirst, tlast, common, vpvn, dist.data()
+            );
+            o = ranges::copy(dist, o).out;
+          }
+        }
+      }
+
+      for (; first != last; ++first)
+      {
+        *o = distance(*first, ws);
+        ++o;
+      }
+      return o;
+    }
+  ;
+
+  if constexpr(
+    ranges::random_access_range<Population> &&
+    ranges::sized_range<Population> &&
+    random_access_iterator<OutIter>
+  )
+  {
+    size_t const size = ranges::size(population);
+    size_t const nchunks = min(nthreads, size);
+    if (nchunks > 1)
+    {
+      // Chunk c is [size*c/nchunks,size*(c+1)/nchunks)...
+      auto const chunk_offset = 
+        [&](size_t const c) 
+        { 
+          return static_cast<ranges::range_difference_t<Population>>(
+            size*c/nchunks
+          );
+        }
+      ;
+
+      vector<exception_ptr> errors(nchunks);
+      auto const run_chunk =
+        [&](size_t const c)
+        {
+          try
+          {
+            run(
+              ranges::cbegin(population) + chunk_offset(c),
+              ranges::cbegin(population) + chunk_offset(c+1),
+              out + chunk_offset(c)
+            );
+          }
+          catch (...)
+          {
+            errors[c] = current_exception();
+          }
+        }
+      ;
+
+      vector<thread> threads;
+      try
+      {
+        threads.reserve(nchunks-1);
+        for (size_t c{1}; c != nchunks; ++c)
+          threads.emplace_back(run_chunk, c);
+      }
+      catch (...)
+      {
+        // NOTE: Destroying a joinable std::thread calls std::terminate()...
+        for (auto& t : threads)
+          t.join();
+        throw;
+      }
+      run_chunk(0);
+      for (auto& t : threads)
+        t.join();
+
+      for (auto const& e : errors)
+        if (e)
+          rethrow_exception(e);
+      return out + chunk_offset(nchunks);
+    }
+  }
+
+  return run(ranges::cbegin(population), ranges::cend(population), out);
+}
+
+//=============================================================================
+
+//
+// hamming(a,b)
+//
+// Returns the number of positions at which a and b differ plus the
+// difference of their lengths, i.e., the Hamming distance of a and b if they
+// have the same length.
+//
+// This is an upper bound on levenshtein(a,b) and, like it, is 0 only if a
+// and b are equal, but it is a different distance that can rank individuals
+// differently even when all lengths are equal, e.g., for the target "abcdef"
+// "bcdefa" has a Levenshtein distance of 2 but a Hamming distance of 6
+// whereas "abcxyz" has both distances equal to 3. It is computed in O(n) time
+// instead of O(n*m) (see hamming_fitness).
+//
+// Contiguous ranges of byte-sized integral elements are compared 64 bytes per
+// step (AVX2 compares, movemasks, and a popcount) if the CPU supports AVX2,
+// otherwise 8 bytes per step (SWAR). Other ranges are compared element by
+// element.
+//
+namespace detail {
+
+// Returns the number of bytes at which the 8 bytes at a and b differ.
+inline int hamming_bytes8(unsigned char const* const a,
+  unsigned char const* const b) noexcept
+{
+  constexpr std::uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+  std::uint64_t x, y;
+  std::memcpy(&x, a, sizeof x);
+  std::memcpy(&y, b, sizeof y);
+  x ^= y;
+  // A byte's high bit becomes set if any of its bits are...
+  return std::popcount((((x & low7) + low7) | x) & ~low7);
+}
+
+inline std::size_t hamming_bytes_scalar(
+  unsigned char const* const a, unsigned char const* const b,
+  std::size_t const n
+) noexcept
+{
+  std::size_t retval{};
+  std::size_t i{};
+  for (; i+8 <= n; i += 8)
+    retval += static_cast<std::size_t>(hamming_bytes8(a+i, b+i));
+  for (; i != n; ++i)
+    retval += a[i] != b[i];
+  return retval;
+}
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+// Returns the 32-bit mask of the bytes at which the 32 bytes at a and b are
+// equal.
+__attribute__((target("avx2")))
+inline std::uint32_t equal_bytes_avx2(unsigned char const* const a,
+  unsigned char const* const b) noexcept
+{
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+    _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a)),
+    _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b))
+  )));
+}
+
+__attribute__((target("avx2,popcnt")))
+inline std::size_t hamming_bytes_avx2(
+  unsigned char const* const a, unsigned char const* const b,
+  std::size_t const n
+) noexcept
+{
+  std::size_t retval{};
+  std::size_t i{};
+  for (; i+64 <= n; i += 64)
+  {
+    std::uint64_t const equal =
+      std::uint64_t{equal_bytes_avx2(a+i, b+i)} |
+      std::uint64_t{equal_bytes_avx2(a+i+32, b+i+32)} << 32;
+    retval += static_cast<std::size_t>(64 - std::popcount(equal));
+  }
+  if (i+32 <= n)
+  {
+    retval += static_cast<std::size_t>(
+      32 - std::popcount(equal_bytes_avx2(a+i, b+i))
+    );
+    i += 32;
+  }
+  return retval + hamming_bytes_scalar(a+i, b+i, n-i);
+}
+
+//
+// The same as hamming_bytes_avx2() except a and b must both be readable up to
+// n rounded up to a multiple of 32 bytes (e.g., arena_population slots) so
+// the last (partial) 32-byte block is compared whole with its excess bits
+// masked off instead of being compared by scalar code.
+//
+__attribute__((target("avx2,popcnt")))
+inline std::size_t hamming_padded_bytes_avx2(
+  unsigned char const* const a, unsigned char const* const b,
+  std::size_t const n
+) noexcept
+{
+  std::size_t retval{};
+  std::size_t i{};
+  for (; i+64 <= n; i += 64)
+  {
+    std::uint64_t const equal =
+      std::uint64_t{equal_bytes_avx2(a+i, b+i)} |
+      std::uint64_t{equal_bytes_avx2(a+i+32, b+i+32)} << 32;
+    retval += static_cast<std::size_t>(64 - std::popcount(equal));
+  }
+  for (; i < n; i += 32)
+  {
+    std::uint32_t differ = ~equal_bytes_avx2(a+i, b+i);
+    if (n-i < 32)
+      differ &= (std::uint32_t{1} << (n-i)) - 1;
+    retval += static_cast<std::size_t>(std::popcount(differ));
+  }
+  return retval;
+}
+
+#endif // #ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+// Returns the number of bytes at which a[0,n) and b[0,n) differ.
+inline std::size_t hamming_bytes(
+  void const* const a, void const* const b, std::size_t const n
+) noexcept
+{
+  auto const* const pa = static_cast<unsigned char const*>(a);
+  auto const* const pb = static_cast<unsigned char const*>(b);
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+  if (n >= 32 && cpu_supports_avx2())
+    return hamming_bytes_avx2(pa, pb, n);
+#endif
+  return hamming_bytes_scalar(pa, pb, n);
+}
+
+} // namespace detail
+
+template <typename StringA, typename StringB>
+requires
+  std::ranges::sized_range<StringA> &&
+  std::ranges::sized_range<StringB> &&
+  std::ranges::forward_range<StringA> &&
+  std::ranges::forward_range<StringB> &&
+  std::same_as<
+    std::ranges::range_value_t<StringA>,
+    std::ranges::range_value_t<StringB>
+  >
+std::size_t hamming(StringA const& a, StringB const& b)
+{
+  using namespace std;
+  using value_type = ranges::range_value_t<StringA>;
+
+  size_t const asize = ranges::size(a);
+  size_t const bsize = ranges::size(b);
+  size_t const common = min(asize, bsize);
+  size_t const length_difference = asize < bsize ? bsize-asize : asize-bsize;
+
+  if constexpr(
+    detail::is_bit_parallel_element_v<value_type> &&
+    ranges::contiguous_range<StringA> &&
+    ranges::contiguous_range<StringB>
+  )
+    return detail::hamming_bytes(ranges::data(a), ranges::data(b), common)
+      + length_difference;
+  else
+  {
+    size_t retval = length_difference;
+    auto a_iter = ranges::cbegin(a);
+    auto b_iter = ranges::cbegin(b);
+    for (size_t i{}; i != common; ++i, ++a_iter, ++b_iter)
+      retval += *a_iter != *b_iter;
+    return retval;
+  }
+}
+
+//
+// hamming_batch(target, population, out)
+//
+// Writes hamming(target,individual) for each individual in population to out
+// (in order) and returns the resulting output iterator.
+//
+// If population is an arena_population of byte-sized elements (and the CPU
+// supports AVX2) the target is copied once into a buffer padded to a
+// multiple of 32 bytes and each individual is compared in place in its
+// (padded) arena slot with no scalar tail, which matters for short
+// individuals.
+//
+template <
+  std::ranges::forward_range Target,
+  std::ranges::forward_range Population,
+  typename OutIter
+>
+requires
+  std::ranges::sized_range<Target> &&
+  std::ranges::forward_range<std::ranges::range_reference_t<Population>> &&
+  std::ranges::sized_range<std::ranges::range_reference_t<Population>> &&
+  std::same_as<
+    std::ranges::range_value_t<Target>,
+    std::ranges::range_value_t<std::ranges::range_value_t<Population>>
+  > &&
+  std::output_iterator<OutIter, std::size_t>
+OutIter hamming_batch(
+  Target const& target,
+  Population const& population,
+  OutIter out
+)
+{
+  using namespace std;
+  using value_type = ranges::range_value_t<Target>;
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+  if constexpr(
+    detail::is_bit_parallel_element_v<value_type> &&
+    same_as<Population, arena_population<value_type>>
+  )
+  {
+    if (detail::cpu_supports_avx2())
+    {
+      size_t const m = ranges::size(target);
+      vector<unsigned char> padded((m+31) / 32 * 32);
+      ranges::transform(target, padded.begin(),
+        [](value_type const& v) { return static_cast<unsigned char>(v); });
+
+      // NOTE: Slots span a multiple of 64 bytes so every block read is
+      //       within an individual's slot...
+      auto const* slot =
+        reinterpret_cast<unsigned char const*>(population.data());
+      for (size_t const length : population.lengths())
+      {
+        size_t const common = min(m, length);
+        *out = detail::hamming_padded_bytes_avx2(padded.data(), slot, common)
+          + (m < length ? length-m : m-length);
+        ++out;
+        slot += population.stride();
+      }
+      return out;
+    }
+  }
+#endif
+
+  for (auto const& individual : population)
+  {
+    *out = hamming(target, individual);
+    ++out;
+  }
+  return out;
+}
+
+//=============================================================================
+
+//
+// incremental_levenshtein<T>
+// class template
+//
+// Computes levenshtein(target,individual) for a fixed target and keeps every
+// checkpoint_stride'th DP row of the individual (i.e., row i is the distances
+// of the individual's first i elements to every prefix of the target) so
+// that after the individual's elements at indices >= first are changed only
+// the rows after the last checkpoint at or before row first need to be
+// recomputed. Use with mutate_reporting_first(), e.g.,
+//
+//   incremental_levenshtein<char> eval(target);
+//   eval.assign(individual);
+//   if (auto first = mutate_reporting_first(individual, rate, m, urbg))
+//     eval.update(individual, *first);
+//   eval.distance();
+//
+// NOTE: update() can only be used if the individual's size is unchanged
+//       since the last assign() (otherwise assign() is done).
+//
+template <typename T>
+class incremental_levenshtein
+{
+public:
+  using value_type = T;
+  using cell_type = std::uint32_t;
+
+private:
+  std::vector<T> target_;
+  std::size_t stride_;
+  std::size_t individual_size_{};
+  std::size_t distance_;
+  std::vector<cell_type> checkpoints_;  // row k*stride_ is at k*(m+1)
+  std::vector<cell_type> rows_;         // two rows of m+1 cells each
+
+  // Recomputes rows (k*stride_,n] where first_iter refers to element k*stride_
+  template <std::forward_iterator Iter>
+  void recompute(std::size_t const k, Iter iter)
+  {
+    using namespace std;
+
+    size_t const m = target_.size();
+    cell_type* prev_row = rows_.data();
+    cell_type* cur_row = prev_row + m+1;
+    copy_n(checkpoints_.data() + k*(m+1), m+1, prev_row);
+
+    for (size_t i = k*stride_; i != individual_size_; ++i, ++iter)
+    {
+      detail::levenshtein_next_row(
+        prev_row, cur_row, static_cast<cell_type>(i+1), 
+        *iter, target_.data(), m
+      );
+      swap(prev_row, cur_row);
+
+      if ((i+1) % stride_ == 0)
+        copy_n(prev_row, m+1, checkpoints_.data() + (i+1)/stride_*(m+1));
+    }
+    distance_ = prev_row[m];
+  }
+
+public:
+  template <std::ranges::forward_range Target>
+  requires std::same_as<std::ranges::range_value_t<Target>,T>
+  explicit incremental_levenshtein(
+    Target const& target, 
+    std::size_t const checkpoint_stride = 16
+  ) :
+    target_(std::ranges::cbegin(target), std::ranges::cend(target)),
+    stride_{checkpoint_stride != 0 ? checkpoint_stride : 1},
+    distance_{target_.size()},
+    checkpoints_(target_.size()+1),
+    rows_(2*(target_.size()+1))
+  {
+    std::iota(checkpoints_.begin(), checkpoints_.end(), cell_type{});
+  }
+
+  std::vector<T> const& target() const noexcept { return target_; }
+  std::size_t checkpoint_stride() const noexcept { return stride_; }
+
+  // Returns levenshtein(target(),individual) of the last assign()/update().
+  std::size_t distance() const noexcept { return distance_; }
+
+  // Computes all rows of individual. Returns distance().
+  template <std::ranges::forward_range Individual>
+  requires
+    std::ranges::sized_range<Individual> &&
+    std::same_as<std::ranges::range_value_t<Individual>,T>
+  std::size_t assign(Individual const& individual)
+  {
+    individual_size_ = std::ranges::size(individual);
+    checkpoints_.resize((individual_size_/stride_+1)*(target_.size()+1));
+    recompute(0, std::ranges::cbegin(individual));
+    return distance_;
+  }
+
+  // Recomputes the rows of individual given its elements at indices < first
+  // are unchanged since the last assign()/update(). Returns distance().
+  template <std::ranges::forward_range Individual>
+  requires
+    std::ranges::sized_range<Individual> &&
+    std::same_as<std::ranges::range_value_t<Individual>,T>
+  std::size_t update(Individual const& individual, std::size_t const first)
+  {
+    if (std::ranges::size(individual) != individual_size_)
+      return assign(individual);
+    if (first >= individual_size_)
+      return distance_;
+
+    std::size_t const k = first / stride_;
+    recompute(
+      k, 
+      std::ranges::next(
+        std::ranges::cbegin(individual), 
+        static_cast<std::ranges::range_difference_t<Individual>>(k*stride_)
+      )
+    );
+    return distance_;
+  }
+};
+
+//=============================================================================
+
+//
+// levenshtein_prefix_shared(target, population, out)
+//
+// Writes levenshtein(target,individual) for each individual in population to
+// out (in population's order) and returns the resulting output iterator.
+//
+// The individuals are visited in sorted order so consecutive individuals
+// share their longest common prefixes, i.e., this walks an implicit trie of
+// the population. The state after the first i elements of an individual 
+// only depends on those i elements, so the states of a shared prefix are
+// computed once for every individual having that prefix. In a converged
+// population most states are shared. The state kept per prefix length is:
+//   * for byte-sized elements, the bit-parallel vertical delta vectors and
+//     distance with the target as the pattern, otherwise
+//   * the DP row with the individual as the outer dimension.
+//
+template <
+  std::ranges::forward_range Target,
+  std::ranges::random_access_range Population,
+  typename OutIter
+>
+requires
+  std::ranges::sized_range<Population> &&
+  std::ranges::forward_range<std::ranges::range_value_t<Population>> &&
+  std::same_as<
+    std::ranges::range_value_t<Target>,
+    std::ranges::range_value_t<std::ranges::range_value_t<Population>>
+  > &&
+  std::totally_ordered<std::ranges::range_value_t<Target>> &&
+  std::output_iterator<OutIter, std::size_t>
+OutIter levenshtein_prefix_shared(
+  Target const& target,
+  Population const& population,
+  OutIter out
+)
+{
+  using namespace std;
+  using value_type = ranges::range_value_t<Target>;
+
+  vector<value_type> const target_v(ranges::cbegin(target), ranges::cend(target));
+  size_t const m = target_v.size();
+
+  // Sort indices of the individuals...
+  size_t const psize = ranges::size(population);
+  vector<size_t> order(psize);
+  iota(order.begin(), order.end(), size_t{});
+  auto const individual = 
+    [&](size_t const i) -> decltype(auto) 
+    { 
+      return ranges::cbegin(population)[
+        static_cast<ranges::range_difference_t<Population>>(i)
+      ]; 
+    }
+  ;
+  // NOTE: Any lexicographical order groups shared prefixes together so
+  //       contiguous byte-sized individuals are compared with std::memcmp().
+  using individual_type = ranges::range_value_t<Population>;
+  if constexpr(
+    detail::is_bit_parallel_element_v<value_type> &&
+    ranges::contiguous_range<individual_type const> &&
+    ranges::sized_range<individual_type const>
+  )
+    ranges::sort(
+      order,
+      [&](size_t const a, size_t const b)
+      {
+        auto const& ia = individual(a);
+        auto const& ib = individual(b);
+        size_t const asize = ranges::size(ia);
+        size_t const bsize = ranges::size(ib);
+        int const cmp = 
+          memcmp(ranges::data(ia), ranges::data(ib), min(asize, bsize));
+        return cmp < 0 || (cmp == 0 && asize < bsize);
+      }
+    );
+  else
+    ranges::sort(
+      order,
+      [&](size_t const a, size_t const b)
+      {
+        return ranges::lexicographical_compare(individual(a), individual(b));
+      }
+    );
+
+  size_t max_size{};
+  for (auto const& i : population)
+    max_size = std::max(max_size, static_cast<size_t>(ranges::distance(i)));
+
+  // Walks the individuals in sorted order calling next_state(i,x) to compute
+  // state i+1 from state i and element x, and distance(i) to obtain the
+  // distance of state i...
+  auto const walk =
+    [&](auto next_state, auto distance)
+    {
+      vector<size_t> distances(psize);
+      size_t prev{psize};  // index of the previous individual (none at first)
+      for (size_t const cur : order)
+      {
+        auto const& ind = individual(cur);
+
+        // States [0,lcp] are shared with the previous individual...
+        size_t lcp{};
+        auto iter = ranges::cbegin(ind);
+        if (prev != psize)
+        {
+          iter = ranges::mismatch(ind, individual(prev)).in1;
+          lcp = static_cast<size_t>(ranges::distance(ranges::cbegin(ind), iter));
+        }
+
+        size_t i = lcp;
+        for (; iter != ranges::cend(ind); ++iter, ++i)
+          next_state(i, *iter);
+        distances[cur] = distance(i);
+        prev = cur;
+      }
+      return ranges::copy(distances, out).out;
+    }
+  ;
+
+  if constexpr(detail::is_bit_parallel_element_v<value_type>)
+  {
+    if (m != 0)
+    {
+      size_t const nwords = detail::bit_parallel_num_words(m);
+      vector<uint64_t> peq(detail::bit_parallel_alphabet_size*nwords);
+      detail::bit_parallel_fill_peq(
+        target_v.cbegin(), target_v.cend(), nwords, peq.data()
+      );
+
+      if (m <= detail::bit_parallel_word_bits)
+      {
+        uint64_t const last = uint64_t{1} << (m-1);
+        vector<detail::bit_parallel_word_state> states(max_size+1);
+        states[0].dist = m;
+        return walk(
+          [&](size_t const i, value_type const& x)
+          {
+            states[i+1] = states[i];
+            detail::bit_parallel_word_step(
+              states[i+1], peq[detail::bit_parallel_index(x)], last
+            );
+          },
+          [&](size_t const i) { return states[i].dist; }
+        );
+      }
+      else
+      {
+        // State i's vp and vn blocks are at vpvn[2*i*nwords]...
+        uint64_t const last = 
+          uint64_t{1} << ((m-1) % detail::bit_parallel_word_bits);
+        vector<uint64_t> vpvn((max_size+1)*2*nwords);
+        vector<size_t> dists(max_size+1);
+        fill_n(vpvn.begin(), nwords, ~uint64_t{});
+        dists[0] = m;
+        return walk(
+          [&](size_t const i, value_type const& x)
+          {
+            uint64_t* const next = vpvn.data() + 2*(i+1)*nwords;
+            copy_n(vpvn.data() + 2*i*nwords, 2*nwords, next);
+            detail::bit_parallel_blocks_state st{next, next+nwords, dists[i]};
+            detail::bit_parallel_blocks_step(
+              st, peq.data() + detail::bit_parallel_index(x)*nwords, 
+              nwords, last
+            );
+            dists[i+1] = st.dist;
+          },
+          [&](size_t const i) { return dists[i]; }
+        );
+      }
+    }
+  }
+
+  // Row i of the DP matrix is at rows[i*(m+1)]...
+  using cell_type = uint32_t;
+  vector<cell_type> rows((max_size+1)*(m+1));
+  iota(rows.begin(), rows.begin()+(m+1), cell_type{});
+  return walk(
+    [&](size_t const i, value_type const& x)
+    {
+      detail::levenshtein_next_row(
+        rows.data() + i*(m+1), rows.data() + (i+1)*(m+1),
+        static_cast<cell_type>(i+1), x, target_v.data(), m
+      );
+    },
+    [&](size_t const i) { return rows[i*(m+1)+m]; }
+  );
+}
+
+//=============================================================================
+
+namespace detail {
+
+// Returns the characters char_mutator and stateless_char_mutator produce.
+inline std::string mutation_chars()
+{
+  std::string retval;
+  for (short i{}; i != std::numeric_limits<char>::max()+1; ++i)
+    if (std::isalnum(i) || std::ispunct(i) || (i == ' '))
+      retval.push_back(i);
+  return retval;
+}
+
+//
+// uniform_below(urbg, n)
+//
+// Returns a uniformly distributed value in [0,n) for n > 0. If URBG produces
+// full-range 32-bit values, Lemire's multiply-shift method with rejection
+// ("Fast Random Integer Generation in an Interval", 2019) is used. This is
+// unbiased, needs no division in the common case, and (unlike
+// std::uniform_int_distribution) gives the same results with every standard
+// library. Otherwise std::uniform_int_distribution is used.
+//
+template <typename URBG>
+requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+constexpr std::uint32_t uniform_below(URBG&& urbg, std::uint32_t const n)
+{
+  using namespace std;
+  using engine = remove_cvref_t<URBG>;
+
+  if constexpr(
+    engine::min() == 0 && 
+    engine::max() == numeric_limits<uint32_t>::max()
+  )
+  {
+    uint64_t m = uint64_t{static_cast<uint32_t>(urbg())} * n;
+    uint32_t low = static_cast<uint32_t>(m);
+    if (low < n)
+    {
+      uint32_t const threshold = static_cast<uint32_t>(-n) % n;
+      while (low < threshold)
+      {
+        m = uint64_t{static_cast<uint32_t>(urbg())} * n;
+        low = static_cast<uint32_t>(m);
+      }
+    }
+    return static_cast<uint32_t>(m >> 32);
+  }
+  else
+    return uniform_int_distribution<uint32_t>(0, n-1)(urbg);
+}
+
+// Returns 64 uniformly random bits from urbg.
+template <typename URBG>
+requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+std::uint64_t random_u64(URBG&& urbg)
+{
+  return std::uniform_int_distribution<std::uint64_t>{}(urbg);
+}
+
+//
+// Four xorshift128+ generators (Vigna 2017) used by fill_mutation_chars() to
+// produce random bytes in bulk: lane l's state is (s0[l],s1[l]). The AVX2 code
+// advances all four lanes with one set of 256-bit operations; the scalar code
+// advances them one at a time. Both produce the same sequence of values.
+//
+struct xorshift128p_lanes
+{
+  std::uint64_t s0[4];
+  std::uint64_t s1[4];
+
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  explicit xorshift128p_lanes(URBG&& urbg)
+  {
+    for (std::size_t l{}; l != 4; ++l)
+    {
+      s0[l] = random_u64(urbg);
+      s1[l] = random_u64(urbg) | 1;  // the state must not be all zeros
+    }
+  }
+
+  std::uint64_t next(std::size_t const l) noexcept
+  {
+    std::uint64_t x = s0[l];
+    std::uint64_t const y = s1[l];
+    s0[l] = y;
+    x ^= x << 23;
+    s1[l] = x ^ y ^ (x >> 17) ^ (y >> 26);
+    return s1[l] + y;
+  }
+};
+
+//
+// Writes n characters chosen uniformly from valid[0,size) to out using lanes
+// (each 64-bit value is used as four 16-bit values).
+//
+// Each 16-bit value x is mapped to index (x*size) >> 16 which is unbiased
+// when x is rejected if the low 16 bits of x*size are < 65536 % size (i.e.,
+// Lemire's method on 16-bit values). Requires 0 < size <= 256.
+//
+inline void fill_mutation_chars_scalar(
+  char* out, std::size_t n,
+  char const* const valid, std::uint32_t const size,
+  xorshift128p_lanes& lanes
+)
+{
+  std::uint32_t const threshold = 65536U % size;
+  while (n != 0)
+    for (std::size_t l{}; l != 4 && n != 0; ++l)
+    {
+      std::uint64_t w = lanes.next(l);
+      for (int k{}; k != 4 && n != 0; ++k, w >>= 16)
+      {
+        std::uint32_t const m = static_cast<std::uint32_t>(w & 0xFFFF) * size;
+        if ((m & 0xFFFF) >= threshold)
+        {
+          *out++ = valid[m >> 16];
+          --n;
+        }
+      }
+    }
+}
+
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+// Advances all four lanes of (s0,s1) returning the four 64-bit outputs.
+__attribute__((target("avx2")))
+inline __m256i xorshift128p_next_avx2(__m256i& s0, __m256i& s1) noexcept
+{
+  __m256i x = s0;
+  __m256i const y = s1;
+  s0 = y;
+  x = _mm256_xor_si256(x, _mm256_slli_epi64(x, 23));
+  s1 = _mm256_xor_si256(
+    _mm256_xor_si256(x, y),
+    _mm256_xor_si256(_mm256_srli_epi64(x, 17), _mm256_srli_epi64(y, 26))
+  );
+  return _mm256_add_epi64(s1, y);
+}
+
+// Returns all-ones 16-bit lanes where low < threshold (unsigned) given
+// threshold_minus_one (and threshold != 0).
+__attribute__((target("avx2")))
+inline __m256i less_epu16_avx2(__m256i const low,
+  __m256i const threshold_minus_one) noexcept
+{
+  return _mm256_cmpeq_epi16(_mm256_min_epu16(low, threshold_minus_one), low);
+}
+
+//
+// The same as fill_mutation_chars_scalar() except 32 characters are produced
+// per step for an alphabet of consecutive characters, i.e.,
+// valid[i] == first+i, so indices are mapped to characters with a byte add.
+// Returns the number of characters written (the rest, fewer than 32, are
+// left for the scalar code).
+//
+__attribute__((target("avx2")))
+inline std::size_t fill_mutation_chars_avx2(
+  char* const out, std::size_t const n,
+  char const first, std::uint32_t const size,
+  xorshift128p_lanes& lanes
+)
+{
+  std::uint32_t const threshold = 65536U % size;
+  __m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(lanes.s0));
+  __m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(lanes.s1));
+  __m256i const vsize = _mm256_set1_epi16(static_cast<short>(size));
+  __m256i const vfirst = _mm256_set1_epi8(first);
+  __m256i const vthreshold_minus_one =
+    _mm256_set1_epi16(static_cast<short>(threshold-1));
 
-  vector<size_t> prev_row(bsize+1);
-  iota(prev_row.begin(), prev_row.end(), size_t{});
+  std::size_t written{};
+  while (n - written >= 32)
+  {
+    __m256i const r0 = xorshift128p_next_avx2(s0, s1);
+    __m256i const r1 = xorshift128p_next_avx2(s0, s1);
+    __m256i const index0 = _mm256_mulhi_epu16(r0, vsize);
+    __m256i const index1 = _mm256_mulhi_epu16(r1, vsize);
 
-  vector<size_t> cur_row(bsize+1, 0);
+    // Lanes whose low 16 bits of x*size are < threshold are rejected...
+    __m256i reject0 = _mm256_setzero_si256();
+    __m256i reject1 = _mm256_setzero_si256();
+    if (threshold != 0)
+    {
+      reject0 = less_epu16_avx2(_mm256_mullo_epi16(r0, vsize),
+        vthreshold_minus_one);
+      reject1 = less_epu16_avx2(_mm256_mullo_epi16(r1, vsize),
+        vthreshold_minus_one);
+    }
+    __m256i const reject = _mm256_or_si256(reject0, reject1);
 
-  auto const asize = ranges::size(a);
-  auto a_iter = ranges::cbegin(a);    // or ranges::begin()
-  auto b_iter = ranges::cbegin(b);    // or ranges::end()
-  for (size_t i{}; i != asize; ++i)
-  {
-    cur_row.front() = i+1;
-    for (size_t j{}; j != bsize; ++j)
+    // NOTE: packus interleaves the 128-bit halves of index0 and index1 which
+    //       is harmless since every value is independent and uniform.
+    __m256i const chars =
+      _mm256_add_epi8(_mm256_packus_epi16(index0, index1), vfirst);
+    if (_mm256_testz_si256(reject, reject))
     {
-      size_t const insert_cost = cur_row[j]+1;
-      size_t const subst_cost = prev_row[j] + (a_iter[i] != b_iter[j]);
-      size_t const del_cost = prev_row[j+1]+1;
-      cur_row[j+1] = min(del_cost, insert_cost, subst_cost);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out+written), chars);
+      written += 32;
+    }
+    else
+    {
+      // Rarely (at most size/65536 per value) some values are rejected...
+      // (packs keeps each mask lined up with its character)...
+      alignas(32) char c[32];
+      alignas(32) char r[32];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(c), chars);
+      _mm256_store_si256(reinterpret_cast<__m256i*>(r),
+        _mm256_packs_epi16(reject0, reject1));
+      for (std::size_t i{}; i != 32; ++i)
+        if (r[i] == 0)
+          out[written++] = c[i];
     }
-    swap(prev_row, cur_row);
   }
-  return prev_row.back();
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.s0), s0);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.s1), s1);
+  return written;
 }
 
-//=============================================================================
+#endif // #ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+
+//
+// Writes out.size() characters chosen uniformly from valid to out. The
+// random bits come from four xorshift128+ generators seeded from urbg, i.e.,
+// urbg is only called a fixed number of times regardless of out.size().
+// Requires valid.size() <= 256 (otherwise out is left unchanged).
+//
+// NOTE: The AVX2 code consumes the random values in a different order than
+//       the scalar code so the characters written (but not their
+//       distribution) depend on whether the CPU supports AVX2.
+//
+template <typename URBG>
+requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+void fill_mutation_chars(
+  std::span<char> const out,
+  std::string const& valid,
+  URBG&& urbg
+)
+{
+  if (out.empty() || valid.empty() || valid.size() > 256)
+    return;
+
+  xorshift128p_lanes lanes(urbg);
+  auto const size = static_cast<std::uint32_t>(valid.size());
+  std::size_t written{};
+#ifdef UWINDSOR_2023W_COMP3400_X86_SIMD
+  bool consecutive = true;
+  for (std::uint32_t i{1}; i != size && consecutive; ++i)
+    consecutive = valid[i] == static_cast<char>(valid[0]+i);
+  if (consecutive && out.size() >= 32 && cpu_supports_avx2())
+    written = fill_mutation_chars_avx2(
+      out.data(), out.size(), valid[0], size, lanes
+    );
+#endif
+  fill_mutation_chars_scalar(
+    out.data()+written, out.size()-written, valid.data(), size, lanes
+  );
+}
+
+} // namespace detail
 
 class char_mutator
 {
@@ -106,16 +2373,7 @@ private:
 
 public:
   char_mutator() :
-    valid_chars{
-      []()
-      {
-        std::string retval;
-        for (short i{}; i != std::numeric_limits<char>::max()+1; ++i)
-          if (std::isalnum(i) || std::ispunct(i) || (i == ' '))
-            retval.push_back(i);
-        return retval;
-      }()
-    },
+    valid_chars{ detail::mutation_chars() },
     ud(0, valid_chars.size() != 0 ? valid_chars.size()-1 : 0),
     re(std::random_device{}())
   {
@@ -126,6 +2384,64 @@ public:
   {
     return valid_chars[ud(re)];
   }
+
+  // Fills out with random valid characters (with the same distribution as
+  // operator()) generated in bulk, e.g., to initialize a population.
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  void fill(std::span<char> const out, URBG&& urbg) const
+  {
+    detail::fill_mutation_chars(out, valid_chars, urbg);
+  }
+};
+
+//
+// stateless_char_mutator
+// class
+//
+// The same as char_mutator except the random number generator is passed to
+// each call instead of being stored, i.e., m(element,urbg). This makes it
+// safe to use concurrently (with a generator per thread or per individual)
+// and reproducible (e.g., with philox4x32 keyed by generation and index).
+//
+// To use it with mutate() bind a generator, e.g.,
+//   mutate(individual, rate, m.bind(urbg), urbg);
+//
+class stateless_char_mutator
+{
+private:
+  std::string valid_chars;
+
+public:
+  stateless_char_mutator() :
+    valid_chars{ detail::mutation_chars() }
+  {
+  }
+
+  template <typename T, typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  char operator()(T const&, URBG&& urbg) const
+  {
+    return valid_chars[detail::uniform_below(
+      urbg, static_cast<std::uint32_t>(valid_chars.size())
+    )];
+  }
+
+  // Fills out with random valid characters (see char_mutator::fill()).
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  void fill(std::span<char> const out, URBG&& urbg) const
+  {
+    detail::fill_mutation_chars(out, valid_chars, urbg);
+  }
+
+  // Returns a function object calling (*this)(element,urbg).
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  auto bind(URBG& urbg) const
+  {
+    return [this,&urbg](auto const& element) { return (*this)(element, urbg); };
+  }
 };
 
 //=============================================================================
@@ -163,6 +2479,377 @@ void mutate(
   );
 }
 
+// The same as mutate() (with each element mutated with probability rate
+// independently of the others) except the gaps between consecutive mutated
+// elements are drawn from a geometric distribution instead of drawing a
+// random number for every element. This makes the cost proportional to the
+// number of mutations instead of the length of individual, e.g., for
+// rate == 0.001 about 1/1000th the random numbers are drawn. For
+// random-access ranges the mutated elements are jumped to directly.
+template <
+  std::ranges::range Individual,
+  typename MutateOp,
+  typename URBG
+>
+requires 
+  std::uniform_random_bit_generator<std::remove_cvref_t<URBG>> &&
+  std::invocable<MutateOp,std::ranges::range_value_t<Individual>>
+void mutate_geometric(
+  Individual& individual, 
+  double const rate, 
+  MutateOp&& m,
+  URBG&& urbg
+)
+{
+  using namespace std;
+
+  if (ranges::empty(individual) || !(rate > 0.0))
+    return;
+  if (rate >= 1.0)
+  {
+    ranges::for_each(individual, [&](auto& element) { element = m(element); });
+    return;
+  }
+
+  // gap is the number of unmutated elements before the next mutated one...
+  geometric_distribution<size_t> gap(rate);
+  if constexpr(ranges::random_access_range<Individual> && 
+    ranges::sized_range<Individual>)
+  {
+    using diff_type = ranges::range_difference_t<Individual>;
+    size_t const n = ranges::size(individual);
+    auto const first = ranges::begin(individual);
+    for (size_t i = gap(urbg); i < n;)
+    {
+      auto& element = first[static_cast<diff_type>(i)];
+      element = m(element);
+
+      // NOTE: Compared this way so huge gaps cannot overflow i...
+      size_t const skip = gap(urbg);
+      if (skip >= n-i-1)
+        break;
+      i += skip+1;
+    }
+  }
+  else
+  {
+    auto it = ranges::begin(individual);
+    auto const last = ranges::end(individual);
+    for (;;)
+    {
+      // NOTE: A gap larger than the remaining elements ends the loop...
+      auto const skip = gap(urbg);
+      using diff_type = ranges::range_difference_t<Individual>;
+      if (skip > static_cast<size_t>(numeric_limits<diff_type>::max()) ||
+        ranges::advance(it, static_cast<diff_type>(skip), last) != 0 ||
+        it == last)
+        break;
+      *it = m(*it);
+      ++it;
+    }
+  }
+}
+
+// Changes the length of individual by inserting and erasing elements: each
+// element is, independently with probability rate, either erased or has
+// m(element) inserted before it (with equal probability), and, with
+// probability rate, m(value_type{}) is appended. As in mutate_geometric() the
+// gaps between the edited positions are drawn from a geometric distribution.
+//
+// Since the positions are edited in increasing order, every edit of a
+// gap_buffer is at (or after) its cursor, i.e., the total cost is
+// O(size + edits) (std::string and std::vector shift their tails on every
+// edit instead).
+template <
+  indel_editable Individual,
+  typename MutateOp,
+  typename URBG
+>
+requires 
+  std::uniform_random_bit_generator<std::remove_cvref_t<URBG>> &&
+  std::default_initializable<std::ranges::range_value_t<Individual>> &&
+  std::invocable<MutateOp,std::ranges::range_value_t<Individual>>
+void mutate_indel(
+  Individual& individual, 
+  double const rate, 
+  MutateOp&& m,
+  URBG&& urbg
+)
+{
+  using namespace std;
+  using value_type = ranges::range_value_t<Individual>;
+  using diff_type = ranges::range_difference_t<Individual>;
+
+  if (!(rate > 0.0))
+    return;
+
+  bernoulli_distribution do_erase(0.5);
+  auto it = ranges::begin(individual);
+  if (rate >= 1.0)
+  {
+    // Every position is edited (and there are no gaps to sample)...
+    while (it != ranges::end(individual))
+    {
+      if (do_erase(urbg))
+        it = individual.erase(it);
+      else
+      {
+        it = individual.insert(it, m(*it));
+        ranges::advance(it, 2);
+      }
+    }
+    individual.insert(it, m(value_type{}));
+    return;
+  }
+
+  // gap is the number of unedited positions before the next edited one where
+  // the positions are the elements followed by the end...
+  geometric_distribution<size_t> gap(rate);
+  for (;;)
+  {
+    auto const skip = gap(urbg);
+    if (skip > static_cast<size_t>(numeric_limits<diff_type>::max()) ||
+      ranges::advance(it, static_cast<diff_type>(skip), ranges::end(individual))
+        != 0)
+      break;
+    if (it == ranges::end(individual))
+    {
+      individual.insert(it, m(value_type{}));
+      break;
+    }
+    if (do_erase(urbg))
+      it = individual.erase(it);
+    else
+    {
+      // NOTE: The inserted element and the element it precedes are both
+      //       skipped, i.e., the latter's position was the one edited...
+      it = individual.insert(it, m(*it));
+      ranges::advance(it, 2);
+    }
+  }
+}
+
+// The same as mutate() (using the same random numbers) except the lowest index
+// of the elements that were mutated is returned (or std::nullopt if no element
+// was mutated). This allows incremental_levenshtein to only recompute what
+// could have changed.
+template <
+  std::ranges::range Individual,
+  typename MutateOp,
+  typename URBG
+>
+requires 
+  std::uniform_random_bit_generator<std::remove_cvref_t<URBG>> &&
+  std::invocable<MutateOp,std::ranges::range_value_t<Individual>>
+std::optional<std::size_t> mutate_reporting_first(
+  Individual& individual, 
+  double const rate, 
+  MutateOp&& m,
+  URBG&& urbg
+)
+{
+  using namespace std;
+
+  optional<size_t> first;
+  if (individual.empty())
+    return first;
+
+  std::uniform_real_distribution<double> ud(0.0,1.0);
+  size_t index{};
+  ranges::for_each(
+    individual,
+    [&](auto& element)
+    {
+      if (ud(urbg) < rate)
+      {
+        element = m(element);
+        if (!first)
+          first = index;
+      }
+      ++index;
+    }
+  );
+  return first;
+}
+
+//=============================================================================
+
+namespace detail {
+
+//
+// sequential_sampler<UInt>
+// class template
+//
+// Selects k of the integers [0,n), every k-subset being equally likely (i.e.,
+// the same distribution as std::sample()), one at a time in increasing order
+// without storing the population or the sample. Each call to operator()
+// returns the next selected integer.
+//
+// This is Vitter's Algorithm D ("An Efficient Algorithm for Sequential Random
+// Sampling", ACM TOMS 13(1), 1987): instead of deciding for each integer
+// whether it is selected, the number of integers skipped before the next
+// selected one is generated directly, i.e., selecting all k integers takes
+// O(k) expected time (and O(k) random numbers) regardless of n. When k is not
+// small relative to n (13k >= n) the remaining integers are selected using
+// Vitter's (simpler) Method A which takes O(n) = O(k) time.
+//
+template <typename UInt = std::size_t>
+class sequential_sampler
+{
+private:
+  static constexpr double alpha = 13.0;
+
+  UInt next_{};     // the smallest integer that can still be selected
+  UInt n_{};        // the number of integers that can still be selected
+  UInt k_{};        // the number of integers still to select
+  double vprime_{}; // Algorithm D's V' for the current k_
+  bool method_a_{}; // true once Method A is used (for the remaining calls)
+
+  // Returns a uniformly distributed double in (0,1).
+  template <typename URBG>
+  static double open01(URBG& urbg)
+  {
+    for (;;)
+    {
+      double const u =
+        std::generate_canonical<double,std::numeric_limits<double>::digits>(
+          urbg
+        );
+      if (u > 0.0 && u < 1.0)
+        return u;
+    }
+  }
+
+  // Returns the number of integers to skip using Method A...
+  template <typename URBG>
+  UInt skip_a(URBG& urbg) const
+  {
+    double top = static_cast<double>(n_ - k_);
+    double nreal = static_cast<double>(n_);
+    double const v = open01(urbg);
+    UInt s{};
+    for (double quot = top / nreal; quot > v; quot *= top / nreal)
+    {
+      ++s;
+      --top;
+      --nreal;
+    }
+    return s;
+  }
+
+  // Returns the number of integers to skip using Algorithm D...
+  template <typename URBG>
+  UInt skip_d(URBG& urbg)
+  {
+    using std::exp;
+    using std::log;
+
+    double const nreal = static_cast<double>(n_);
+    double const ninv = 1.0 / static_cast<double>(k_);
+    double const nmin1inv = 1.0 / static_cast<double>(k_-1);
+    double const qu1real = static_cast<double>(n_ - k_ + 1);
+    UInt const qu1 = n_ - k_ + 1;
+
+    for (;;)
+    {
+      // D2: generate X (and S = floor(X)) from the continuous approximation
+      //     of S's distribution...
+      double x;
+      UInt s;
+      for (;;)
+      {
+        x = nreal * (1.0 - vprime_);
+        s = static_cast<UInt>(x);
+        if (s < qu1)
+          break;
+        vprime_ = exp(log(open01(urbg)) * ninv);
+      }
+      double const u = open01(urbg);
+      double const sreal = static_cast<double>(s);
+
+      // D3: accept S using the quick test...
+      double const y1 = exp(log(u * nreal / qu1real) * nmin1inv);
+      vprime_ = y1 * (1.0 - x/nreal) * (qu1real / (qu1real - sreal));
+      if (vprime_ <= 1.0)
+        return s;
+
+      // D4: accept S using the exact test...
+      double y2 = 1.0;
+      double top = nreal - 1.0;
+      double bottom;
+      UInt limit;
+      if (k_-1 > s)
+      {
+        bottom = static_cast<double>(n_ - k_);
+        limit = n_ - s;
+      }
+      else
+      {
+        bottom = nreal - 1.0 - sreal;
+        limit = qu1;
+      }
+      for (UInt t = n_-1; t >= limit; --t)
+      {
+        y2 = (y2 * top) / bottom;
+        --top;
+        --bottom;
+      }
+      if (nreal / (nreal - x) >= y1 * exp(log(y2) * nmin1inv))
+      {
+        vprime_ = exp(log(open01(urbg)) * nmin1inv);
+        return s;
+      }
+      vprime_ = exp(log(open01(urbg)) * ninv);
+    }
+  }
+
+public:
+  constexpr sequential_sampler() = default;
+
+  // Prepares to select min(k,n) of the integers [0,n).
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  sequential_sampler(UInt const n, UInt const k, URBG&& urbg) :
+    n_{n},
+    k_{std::min(k, n)}
+  {
+    method_a_ = !(alpha * static_cast<double>(k_) < static_cast<double>(n_));
+    if (k_ > 1 && !method_a_)
+      vprime_ = std::exp(std::log(open01(urbg)) / static_cast<double>(k_));
+  }
+
+  // The number of integers still to be selected.
+  constexpr UInt remaining() const noexcept { return k_; }
+
+  // Returns the next selected integer. Requires remaining() > 0.
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  UInt operator()(URBG&& urbg)
+  {
+    UInt s;
+    if (k_ == 1)
+      s = std::min(
+        static_cast<UInt>(static_cast<double>(n_) * open01(urbg)), n_-1
+      );
+    else if (!method_a_ &&
+      alpha * static_cast<double>(k_) < static_cast<double>(n_))
+      s = skip_d(urbg);
+    else
+    {
+      method_a_ = true;
+      s = skip_a(urbg);
+    }
+
+    UInt const retval = next_ + s;
+    next_ = retval + 1;
+    n_ -= s + 1;
+    --k_;
+    return retval;
+  }
+};
+
+} // namespace detail
+
 //=============================================================================
 
 // https://en.wikipedia.org/wiki/Crossover_(genetic_algorithm)
@@ -172,7 +2859,8 @@ void mutate(
 //             the number of crossover points is determined randomly (and
 //             uniformly from 0 to minimum lengths of parent1 and parent2),
 //             and, the actual points of crossover are then determined
-//             uniformly over such using std::ranges::sample.
+//             uniformly over such (i.e., as std::ranges::sample would) in
+//             increasing order using detail::sequential_sampler.
 template <typename URBG1, typename URBG2, typename Individual>
 requires
   std::uniform_random_bit_generator<std::remove_cvref_t<URBG1>> &&
@@ -207,25 +2895,13 @@ auto crossover(
 
   // NOTE: There is at least 1 crossover point and both ranges are !empty()
 
-  // Generate indices [1,psize_truncated-1)...
+  // Select ncrossover_points of the indices [1,psize_truncated) in
+  // increasing order...
   //   * NOTE: Remember that crossover points occur *between* range elements.
-  vector<size_t> crossover_indices(psize_truncated-1);
-  iota(crossover_indices.begin(), crossover_indices.end(), size_t{1});
-
-  // Select ncrossover_points...
-  vector<size_t> crossover_offsets;
-  reserve_or_noop(crossover_offsets, ncrossover_points);
-  ranges::sample(
-    crossover_indices, 
-    back_inserter(crossover_offsets), 
-    ncrossover_points, 
-    urbg_crossover_points
-  );
-
-  // Determine adjacent differences so indices are offsets instead...
-  adjacent_difference(
-    begin(crossover_offsets), end(crossover_offsets),
-    begin(crossover_offsets)
+  //   * NOTE: The points are generated as they are needed so neither the
+  //           candidate indices nor the selected ones are stored.
+  detail::sequential_sampler<size_t> crossover_points(
+    psize_truncated-1, ncrossover_points, urbg_crossover_points
   );
 
   // Declare an individual and an output insert iterator to such...
@@ -242,8 +2918,12 @@ auto crossover(
   auto p2pos = ranges::cbegin(parent2);
 
   // Now perform the crossover copying...
-  for (auto const& offset : crossover_offsets)
+  for (size_t prev_point{}; crossover_points.remaining() != 0; )
   {
+    size_t const point = crossover_points(urbg_crossover_points) + 1;
+    size_t const offset = point - prev_point;
+    prev_point = point;
+
     if (which_parent)
       out = copy_n(p1pos, offset, out);
     else
@@ -265,6 +2945,237 @@ auto crossover(
 
 //=============================================================================
 
+namespace detail {
+
+// Returns 32 uniformly random bits from urbg.
+template <typename URBG>
+requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+std::uint32_t random_u32(URBG&& urbg)
+{
+  using engine = std::remove_cvref_t<URBG>;
+  if constexpr(
+    engine::min() == 0 &&
+    engine::max() == std::numeric_limits<std::uint32_t>::max()
+  )
+    return static_cast<std::uint32_t>(urbg());
+  else
+    return std::uniform_int_distribution<std::uint32_t>{}(urbg);
+}
+
+// Returns a uniformly distributed index in [0,n) for n > 0 (see
+// uniform_below()).
+template <typename URBG>
+requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+std::size_t uniform_index(URBG&& urbg, std::size_t const n)
+{
+  if (n <= std::numeric_limits<std::uint32_t>::max())
+    return uniform_below(urbg, static_cast<std::uint32_t>(n));
+  else
+    return std::uniform_int_distribution<std::size_t>(0, n-1)(urbg);
+}
+
+} // namespace detail
+
+//
+// alias_table
+// class
+//
+// Walker's alias method (as constructed by Vose, "A Linear Algorithm for
+// Generating Random Numbers with a Given Distribution", IEEE TSE 17(9), 1991)
+// for drawing index i with probability weights[i] / sum(weights):
+//   * assign(weights) builds the table in O(n) time, and,
+//   * operator()(urbg) draws an index in O(1) time: a uniformly random column
+//     i is chosen and then either i or its alias is returned (using one
+//     32-bit random value and a comparison, i.e., without branching).
+//
+// Each column's probability of keeping i is stored as a 32-bit fixed-point
+// threshold, i.e., probabilities are rounded to multiples of 2^-32 / n.
+//
+// If there are no positive (finite) weights, every index is equally likely.
+//
+class alias_table
+{
+private:
+  struct column
+  {
+    std::uint64_t threshold;  // keep the column's index if bits < threshold
+    std::size_t alias;
+  };
+
+  static constexpr double one = 4294967296.0;  // 2^32
+
+  std::vector<column> columns_;
+  std::vector<double> scaled_;      // scratch space used by assign()
+  std::vector<std::size_t> work_;   // scratch space used by assign()
+
+public:
+  alias_table() = default;
+
+  template <std::ranges::input_range Weights>
+  requires std::convertible_to<std::ranges::range_reference_t<Weights>, double>
+  explicit alias_table(Weights const& weights)
+  {
+    assign(weights);
+  }
+
+  // Rebuilds the table for weights in O(n) time (reusing its memory).
+  template <std::ranges::input_range Weights>
+  requires std::convertible_to<std::ranges::range_reference_t<Weights>, double>
+  void assign(Weights const& weights)
+  {
+    using namespace std;
+
+    scaled_.clear();
+    double sum{};
+    for (auto&& w : weights)
+    {
+      double const d = static_cast<double>(w);
+      double const v = (d > 0.0 && isfinite(d)) ? d : 0.0;
+      scaled_.push_back(v);
+      sum += v;
+    }
+    size_t const n = scaled_.size();
+    columns_.resize(n);
+    if (n == 0)
+      return;
+    if (!(sum > 0.0) || !isfinite(sum))
+    {
+      ranges::fill(scaled_, 1.0);
+      sum = static_cast<double>(n);
+    }
+
+    // Scale so the average is 1 and partition the indices into those below
+    // 1 ("small", from the front of work_) and the rest ("large", from the
+    // back)...
+    work_.resize(n);
+    size_t nsmall{}, nlarge{};
+    double const scale = static_cast<double>(n) / sum;
+    for (size_t i{}; i != n; ++i)
+    {
+      scaled_[i] *= scale;
+      if (scaled_[i] < 1.0)
+        work_[nsmall++] = i;
+      else
+        work_[n - ++nlarge] = i;
+    }
+
+    // Each small column is topped up by a large one (its alias)...
+    while (nsmall != 0 && nlarge != 0)
+    {
+      size_t const s = work_[--nsmall];
+      size_t const l = work_[n - nlarge];
+      columns_[s] = {
+        static_cast<uint64_t>(scaled_[s] * one),
+        l
+      };
+      scaled_[l] = (scaled_[l] + scaled_[s]) - 1.0;
+      if (scaled_[l] < 1.0)
+      {
+        --nlarge;
+        work_[nsmall++] = l;
+      }
+    }
+
+    // Whatever remains is (up to rounding) exactly full...
+    while (nlarge != 0)
+    {
+      size_t const l = work_[n - nlarge--];
+      columns_[l] = { static_cast<uint64_t>(one), l };
+    }
+    while (nsmall != 0)
+    {
+      size_t const s = work_[--nsmall];
+      columns_[s] = { static_cast<uint64_t>(one), s };
+    }
+  }
+
+  std::size_t size() const noexcept { return columns_.size(); }
+  bool empty() const noexcept { return columns_.empty(); }
+
+  // Returns a random index. Requires !empty().
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  std::size_t operator()(URBG&& urbg) const
+  {
+    column const& c = columns_[detail::uniform_index(urbg, columns_.size())];
+    std::size_t const i = static_cast<std::size_t>(&c - columns_.data());
+    return detail::random_u32(urbg) < c.threshold ? i : c.alias;
+  }
+};
+
+//
+// roulette_selection
+// class
+//
+// Fitness-proportionate selection as an evolver selection strategy (see
+// binary_tournament_selection in evolver.hpp): since smaller fitness values
+// are fitter, individual i is selected with probability proportional to
+// 1 / (1 + fitness[i]). prepare(fitness) builds an alias_table in O(n) time
+// once per generation so each selection is O(1).
+//
+// NOTE: operator() does not modify the table so it can be called
+//       concurrently (e.g., by an evolver breeding in parallel).
+//
+class roulette_selection
+{
+private:
+  alias_table table_;
+  std::vector<double> weights_;
+
+public:
+  void prepare(std::span<std::size_t const> const fitness)
+  {
+    weights_.resize(fitness.size());
+    for (std::size_t i{}; i != fitness.size(); ++i)
+      weights_[i] = 1.0 / (1.0 + static_cast<double>(fitness[i]));
+    table_.assign(weights_);
+  }
+
+  // Returns the index of the selected individual. Requires prepare() to
+  // have been called with fitness.
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  std::size_t operator()(std::span<std::size_t const>, URBG&& urbg) const
+  {
+    return table_(urbg);
+  }
+};
+
+//
+// tournament_selection
+// class
+//
+// Selects the fittest (smallest fitness value) of size individuals chosen
+// uniformly at random (with replacement). The fittest is tracked with
+// conditional selects instead of branches since which contestant wins is
+// unpredictable.
+//
+struct tournament_selection
+{
+  std::size_t size = 2;
+
+  template <typename URBG>
+  requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+  std::size_t operator()(std::span<std::size_t const> const fitness,
+    URBG&& urbg) const
+  {
+    std::size_t const n = fitness.size();
+    std::size_t best = detail::uniform_index(urbg, n);
+    std::size_t best_fitness = fitness[best];
+    for (std::size_t k{1}; k < size; ++k)
+    {
+      std::size_t const i = detail::uniform_index(urbg, n);
+      std::size_t const f = fitness[i];
+      bool const fitter = f < best_fitness;
+      best = fitter ? i : best;
+      best_fitness = fitter ? f : best_fitness;
+    }
+    return best;
+  }
+};
+
+//=============================================================================
+
 } // namespace project
 } // namespace comp3400
 } // namespace uwindsor_2023w
@@ -0,0 +1,106 @@
+#ifndef uwindsor_2023w_comp3400_project_spsc_queue_hpp_
+#define uwindsor_2023w_comp3400_project_spsc_queue_hpp_
+
+//=============================================================================
+
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// spsc_queue<T>
+// class template
+//
+// A bounded lock-free single-producer/single-consumer FIFO queue: exactly one
+// thread may call try_push() and exactly one (other) thread may call
+// try_pop().
+//
+// The elements are in a ring buffer whose capacity is a power of two. The
+// producer only writes tail_ and the consumer only writes head_, each on its
+// own cache line. Each side also keeps a cached copy of the other side's
+// index so the shared index is only re-read when the queue looks full (or
+// empty).
+//
+template <typename T>
+requires std::movable<T> && std::default_initializable<T>
+class spsc_queue
+{
+private:
+  static constexpr std::size_t cache_line = 64;
+
+  std::size_t mask_;
+  std::unique_ptr<T[]> slots_;
+
+  alignas(cache_line) std::atomic<std::size_t> head_{};  // next to pop
+  std::size_t cached_tail_{};                            // consumer's copy
+
+  alignas(cache_line) std::atomic<std::size_t> tail_{};  // next to push
+  std::size_t cached_head_{};                            // producer's copy
+
+public:
+  // Constructs a queue that holds at least capacity elements.
+  explicit spsc_queue(std::size_t const capacity) :
+    mask_{std::bit_ceil(capacity != 0 ? capacity : 1) - 1},
+    slots_{std::make_unique<T[]>(mask_+1)}
+  {
+  }
+
+  spsc_queue(spsc_queue const&) = delete;
+  spsc_queue& operator=(spsc_queue const&) = delete;
+
+  std::size_t capacity() const noexcept { return mask_+1; }
+
+  // Producer: appends value and returns true, or, returns false if full.
+  template <typename U>
+  requires std::assignable_from<T&, U&&>
+  bool try_push(U&& value)
+  {
+    std::size_t const tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_)
+    {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_)
+        return false;
+    }
+    slots_[tail & mask_] = std::forward<U>(value);
+    tail_.store(tail+1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: moves the oldest element into value and returns true, or,
+  // returns false if empty.
+  bool try_pop(T& value)
+  {
+    std::size_t const head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_)
+    {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_)
+        return false;
+    }
+    value = std::move(slots_[head & mask_]);
+    head_.store(head+1, std::memory_order_release);
+    return true;
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_spsc_queue_hpp_
@@ -0,0 +1,412 @@
+#ifndef uwindsor_2023w_comp3400_project_steady_state_hpp_
+#define uwindsor_2023w_comp3400_project_steady_state_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "evolver.hpp"
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// steady_state_options
+// class
+//
+// The parameters of a steady_state_evolver (in addition to its
+// evolver_options):
+//   * selection_size is the tournament size used to select each parent, and,
+//   * replacement_size is the number of individuals sampled to choose the
+//     one a child replaces (the least fit of the sample, i.e., an inverse
+//     tournament).
+//
+struct steady_state_options
+{
+  std::size_t selection_size = 2;
+  std::size_t replacement_size = 4;
+};
+
+//=============================================================================
+
+//
+// steady_state_evolver<Individual, Fitness, Mutator>
+// class template
+//
+// A steady-state genetic algorithm: instead of generations separated by a
+// barrier, options.threads workers each repeatedly
+//   1. select two parents (by tournament over the current fitness values),
+//   2. breed a child (crossover() and mutate_geometric() as evolver does),
+//   3. evaluate the child, and,
+//   4. replace the least fit of a random sample of individuals with the
+//      child if the child is at least as fit,
+// so a worker never waits for other workers to finish (e.g., for an
+// expensive evaluation).
+//
+// The population is shared through fine-grained slots: each individual has
+// its own mutex (held only to copy the individual in or out) and the fitness
+// values are atomics so tournaments read them without locking. A
+// replacement re-checks the victim's fitness after locking its slot, i.e.,
+// the population's best fitness never gets worse.
+//
+// The initial population is the same as an evolver's with the same options.
+// After that, results depend on thread scheduling. stats().generation counts
+// population_size children as one generation.
+//
+// A Mutator is invocable as m(element,urbg) or as m(element) (see evolver).
+// Since the workers share the Fitness and Mutator objects, with
+// options.threads > 1 both must be safe to call concurrently, e.g.,
+// stateless_char_mutator (but not char_mutator, whose generator is a data
+// member and would be a data race).
+//
+// NOTE: Parents are selected by tournament since selection strategies (see
+//       evolver) require a std::span of (non-atomic) fitness values.
+//
+template <
+  typename Individual = std::string,
+  typename Fitness = levenshtein_fitness,
+  typename Mutator = stateless_char_mutator
+>
+requires
+  std::ranges::random_access_range<Individual> &&
+  std::ranges::sized_range<Individual> &&
+  back_insertable<Individual> &&
+  (
+    std::invocable<
+      Mutator const&, std::ranges::range_value_t<Individual>, philox4x32&
+    > ||
+    std::invocable<Mutator&, std::ranges::range_value_t<Individual>>
+  )
+class steady_state_evolver
+{
+public:
+  using value_type = std::ranges::range_value_t<Individual>;
+
+private:
+  struct alignas(64) slot
+  {
+    std::mutex m;
+    Individual individual;
+  };
+
+  Individual target_;
+  evolver_options options_;
+  steady_state_options steady_state_options_;
+  Fitness fitness_fn_;
+  Mutator mutator_;
+
+  std::unique_ptr<slot[]> slots_;
+  std::unique_ptr<std::atomic<std::size_t>[]> fitness_;
+
+  std::atomic<std::size_t> births_{};
+  std::atomic<std::size_t> best_fitness_{
+    std::numeric_limits<std::size_t>::max()
+  };
+  std::atomic<std::size_t> best_index_{};
+  std::mutex best_mutex_;
+  std::size_t runs_{};
+  double seconds_{};
+
+  std::size_t size() const noexcept { return options_.population_size; }
+
+  // Returns the index of the fittest (least fit if worst) of k individuals
+  // chosen uniformly at random...
+  template <bool Worst>
+  std::size_t tournament(std::size_t const k, philox4x32& urbg) const
+  {
+    std::size_t best = detail::uniform_index(urbg, size());
+    std::size_t best_fitness = fitness_[best].load(std::memory_order_relaxed);
+    for (std::size_t j{1}; j < k; ++j)
+    {
+      std::size_t const i = detail::uniform_index(urbg, size());
+      std::size_t const f = fitness_[i].load(std::memory_order_relaxed);
+      bool const better = Worst ? f > best_fitness : f < best_fitness;
+      best = better ? i : best;
+      best_fitness = better ? f : best_fitness;
+    }
+    return best;
+  }
+
+  void copy_out(std::size_t const i, Individual& out) const
+  {
+    std::lock_guard lock(slots_[i].m);
+    out = slots_[i].individual;
+  }
+
+  // Records fitness f at index i as the best if it is...
+  void offer_best(std::size_t const i, std::size_t const f)
+  {
+    // NOTE: Improvements are rare so only they take the lock (which keeps
+    //       best_index_ and best_fitness_ consistent)...
+    if (f >= best_fitness_.load(std::memory_order_relaxed))
+      return;
+    std::lock_guard lock(best_mutex_);
+    if (f < best_fitness_.load(std::memory_order_relaxed))
+    {
+      best_index_.store(i, std::memory_order_relaxed);
+      best_fitness_.store(f, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns the mutation function object mutate_geometric() is passed...
+  decltype(auto) mutator_for(philox4x32& urbg)
+  {
+    return detail::mutator_for<value_type>(mutator_, urbg);
+  }
+
+  // Breeds, evaluates, and inserts children until stop is set or done(stats)
+  // is true...
+  template <typename Terminate>
+  void work(std::size_t const worker, Terminate done, std::atomic<bool>& stop,
+    std::chrono::steady_clock::time_point const start)
+  {
+    using namespace std;
+
+    // NOTE: Generation 0 streams were used by the initial population so each
+    //       worker of each run() uses its own stream...
+    philox4x32 urbg(options_.seed, static_cast<uint32_t>(runs_+1), worker);
+    bernoulli_distribution do_crossover(options_.crossover_rate);
+    uniform_int_distribution<size_t> npoints(
+      1, std::max<size_t>(options_.max_crossover_points, 1)
+    );
+
+    Individual p1, p2, child;
+    while (!stop.load(memory_order_relaxed))
+    {
+      if (done(snapshot(start)))
+      {
+        stop.store(true, memory_order_relaxed);
+        break;
+      }
+
+      copy_out(tournament<false>(steady_state_options_.selection_size, urbg),
+        p1);
+      if (do_crossover(urbg))
+      {
+        copy_out(
+          tournament<false>(steady_state_options_.selection_size, urbg), p2
+        );
+        child.clear();
+        beyond_project::crossover(
+          npoints(urbg), urbg, urbg, p1, p2, back_inserter(child)
+        );
+      }
+      else
+        swap(child, p1);
+      mutate_geometric(child, options_.mutation_rate, mutator_for(urbg), urbg);
+      if constexpr(indel_editable<Individual>)
+        mutate_indel(child, options_.indel_rate, mutator_for(urbg), urbg);
+      size_t const f = fitness_fn_(target_, child);
+
+      // Replace the least fit of a sample (unless it became fitter)...
+      size_t const victim =
+        tournament<true>(steady_state_options_.replacement_size, urbg);
+      {
+        lock_guard lock(slots_[victim].m);
+        if (f <= fitness_[victim].load(memory_order_relaxed))
+        {
+          swap(slots_[victim].individual, child);
+          fitness_[victim].store(f, memory_order_relaxed);
+          offer_best(victim, f);
+        }
+      }
+      births_.fetch_add(1, memory_order_relaxed);
+    }
+  }
+
+  evolver_stats snapshot(std::chrono::steady_clock::time_point const start)
+    const
+  {
+    evolver_stats retval = stats();
+    retval.seconds += std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start
+    ).count();
+    return retval;
+  }
+
+public:
+  template <std::ranges::input_range Target>
+  requires std::same_as<std::ranges::range_value_t<Target>, value_type>
+  steady_state_evolver(
+    Target const& target,
+    evolver_options const& options,
+    steady_state_options const& steady_state = {},
+    Fitness fitness = {},
+    Mutator mutator = {}
+  ) :
+    target_(std::ranges::begin(target), std::ranges::end(target)),
+    options_{options},
+    steady_state_options_{steady_state},
+    fitness_fn_(std::move(fitness)),
+    mutator_(std::move(mutator))
+  {
+    using namespace std;
+
+    options_.population_size = std::max<size_t>(options_.population_size, 1);
+    options_.threads = std::max<size_t>(options_.threads, 1);
+    size_t const n = options_.population_size;
+    slots_ = make_unique<slot[]>(n);
+    fitness_ = make_unique<atomic<size_t>[]>(n);
+
+    // The same initial population as an evolver's...
+    for (size_t i{}; i != n; ++i)
+    {
+      philox4x32 urbg(options_.seed, 0, i);
+      auto& individual = slots_[i].individual;
+      individual = target_;
+      if constexpr(
+        convertible_to<Individual&, span<char>> &&
+        requires { mutator_.fill(span<char>{}, urbg); }
+      )
+        mutator_.fill(span<char>(individual), urbg);
+      else
+        mutate_geometric(individual, 1.0, mutator_for(urbg), urbg);
+      size_t const f = fitness_fn_(target_, individual);
+      fitness_[i].store(f, memory_order_relaxed);
+      offer_best(i, f);
+    }
+    births_.store(n, memory_order_relaxed);
+  }
+
+  Individual const& target() const noexcept { return target_; }
+  evolver_options const& options() const noexcept { return options_; }
+
+  // Returns the current statistics: generation is the number of children
+  // (including the initial population) divided by population_size.
+  //
+  // NOTE: This may be called (e.g., by done) while run() is running.
+  evolver_stats stats() const noexcept
+  {
+    evolver_stats retval;
+    std::size_t const births = births_.load(std::memory_order_relaxed);
+    retval.generation = births / size() - 1;
+    retval.evaluations = births;
+    retval.best_fitness = best_fitness_.load(std::memory_order_relaxed);
+    retval.best_index = best_index_.load(std::memory_order_relaxed);
+    retval.seconds = seconds_;
+    return retval;
+  }
+
+  // Returns a copy of the population and its fitness values. (Must not be
+  // called while run() is running.)
+  std::vector<Individual> population() const
+  {
+    std::vector<Individual> retval;
+    retval.reserve(size());
+    for (std::size_t i{}; i != size(); ++i)
+      retval.push_back(slots_[i].individual);
+    return retval;
+  }
+
+  std::vector<std::size_t> fitness() const
+  {
+    std::vector<std::size_t> retval(size());
+    for (std::size_t i{}; i != size(); ++i)
+      retval[i] = fitness_[i].load(std::memory_order_relaxed);
+    return retval;
+  }
+
+  // Returns a copy of the fittest individual.
+  Individual best() const
+  {
+    Individual retval;
+    copy_out(best_index_.load(std::memory_order_relaxed), retval);
+    return retval;
+  }
+
+  // Evolves with options().threads workers (one being the calling thread)
+  // until done(stats()) is true (checked by each worker, with its own copy
+  // of done, before each child). Returns stats().
+  //
+  // If a worker throws an exception, all workers stop and the (first)
+  // exception is rethrown.
+  template <typename Terminate>
+  requires std::predicate<Terminate&, evolver_stats const&>
+  evolver_stats run(Terminate done)
+  {
+    using namespace std;
+
+    auto const start = chrono::steady_clock::now();
+
+    atomic<bool> stop{false};
+    mutex exception_mutex;
+    exception_ptr exception;
+    auto const worker_main =
+      [&](size_t const w)
+      {
+        try
+        {
+          work(w, done, stop, start);
+        }
+        catch (...)
+        {
+          stop.store(true);
+          lock_guard lock(exception_mutex);
+          if (!exception)
+            exception = current_exception();
+        }
+      }
+    ;
+
+    vector<thread> threads;
+    try
+    {
+      threads.reserve(options_.threads-1);
+      for (size_t w{1}; w != options_.threads; ++w)
+        threads.emplace_back(worker_main, w);
+    }
+    catch (...)
+    {
+      // NOTE: Destroying a joinable std::thread calls std::terminate() so the
+      //       threads already started are stopped and joined first...
+      stop.store(true);
+      for (auto& t : threads)
+        t.join();
+      throw;
+    }
+    worker_main(0);
+    for (auto& t : threads)
+      t.join();
+
+    ++runs_;
+    seconds_ += chrono::duration<double>(
+      chrono::steady_clock::now() - start
+    ).count();
+
+    if (exception)
+      rethrow_exception(exception);
+    return stats();
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_steady_state_hpp_
@@ -0,0 +1,89 @@
+//=============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bk_tree.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace std::literals;
+  using uwindsor_2023w::comp3400::project::bk_tree;
+  using uwindsor_2023w::comp3400::project::levenshtein;
+
+  {
+    vector<string> const dict{
+      "book"s, "books"s, "cake"s, "boo"s, "boon"s, "cook"s, "cape"s, "cart"s,
+      "book"s
+    };
+    bk_tree tree(dict);
+    using match = decltype(tree)::match;
+
+    bk_tree<string> empty_tree;
+    cout
+      << (tree.size() == dict.size())
+      << (tree.value(2) == "cake"s)
+      << (tree.find_within("book"s, 0) == vector<match>{{0,0}, {8,0}})
+      << (tree.find_within("book"s, 1) ==
+           vector<match>{{0,0}, {8,0}, {1,1}, {3,1}, {4,1}, {5,1}})
+      << (tree.find_within("xyzzy"s, 2).empty())
+      << (tree.nearest("cak"s, 1) == vector<match>{{2,1}})
+      << (tree.nearest("capt"s, 3) == vector<match>{{6,1}, {7,1}, {2,2}})
+      << (tree.nearest("b"s, 100).size() == dict.size())
+      << (empty_tree.find_within("book"s, 5).empty())
+      << (empty_tree.nearest("book"s, 5).empty())
+      << (tree.insert("brook"s) == dict.size())
+      << (tree.find_within("brook"s, 0) == vector<match>{{dict.size(),0}})
+      << '\n'
+    ;
+  }
+
+  {
+    // The tree's results match a linear scan calling levenshtein()...
+    default_random_engine re{3400};
+    uniform_int_distribution<int> letter('a', 'd');
+    uniform_int_distribution<size_t> length(0, 8);
+    auto const random_string =
+      [&]()
+      {
+        string s(length(re), ' ');
+        ranges::generate(s, [&]() { return static_cast<char>(letter(re)); });
+        return s;
+      }
+    ;
+    vector<string> dict(2000);
+    ranges::generate(dict, random_string);
+    bk_tree tree(dict);
+    using match = decltype(tree)::match;
+
+    bool within_same = true;
+    bool nearest_same = true;
+    for (int i{}; i != 50; ++i)
+    {
+      string const query = random_string();
+      vector<match> all;
+      for (size_t j{}; j != dict.size(); ++j)
+        all.push_back({ j, levenshtein(query, dict[j]) });
+      ranges::sort(all);
+
+      size_t const k = i % 4;
+      vector<match> within;
+      ranges::copy_if(all, back_inserter(within),
+        [k](match const& m) { return m.distance <= k; });
+      within_same = within_same && (tree.find_within(query, k) == within);
+
+      all.resize(10);
+      nearest_same = nearest_same && (tree.nearest(query, 10) == all);
+    }
+    cout << within_same << nearest_same << '\n';
+  }
+}
+
+//=============================================================================
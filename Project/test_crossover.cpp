@@ -1,10 +1,17 @@
 //=============================================================================
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <forward_list>
 #include <iomanip>
 #include <iostream>
+#include <list>
 #include <random>
 #include <string>
+#include <vector>
 #include "project.hpp"
+#include "beyond_project.hpp"
 
 //=============================================================================
 
@@ -104,6 +111,188 @@ int main()
 #endif
     cout << n << ":\t" << quoted(child) << '\n';
   }
+
+  // The crossover points are selected by detail::sequential_sampler which
+  // must select every k-subset of [0,n) with equal probability, in increasing
+  // order. Each count is binomially distributed so each check allows 5
+  // standard deviations...
+  {
+    using uwindsor_2023w::comp3400::project::detail::sequential_sampler;
+
+    auto const near =
+      [](size_t const count, size_t const trials, double const p)
+      {
+        double const sd = sqrt(trials*p*(1.0-p));
+        return abs(static_cast<double>(count) - trials*p) <= 5.0*sd;
+      }
+    ;
+
+    default_random_engine sre{3400};
+    size_t const trials = 100'000;
+
+    // Method A (k is not small relative to n): all 10 2-subsets of [0,5)...
+    array<size_t,25> pairs{};
+    bool sorted_ok = true;
+    for (size_t t{}; t != trials; ++t)
+    {
+      sequential_sampler<size_t> s(5, 2, sre);
+      size_t const a = s(sre);
+      size_t const b = s(sre);
+      sorted_ok = sorted_ok && a < b && b < 5 && s.remaining() == 0;
+      ++pairs[a*5+b];
+    }
+    bool pairs_ok = true;
+    for (size_t a{}; a != 5; ++a)
+      for (size_t b{a+1}; b != 5; ++b)
+        pairs_ok = pairs_ok && near(pairs[a*5+b], trials, 0.1);
+
+    // Algorithm D (k is small relative to n): every value is selected with
+    // probability k/n...
+    array<size_t,300> selected{};
+    for (size_t t{}; t != trials; ++t)
+    {
+      sequential_sampler<size_t> s(selected.size(), 3, sre);
+      size_t prev{};
+      for (size_t i{}; s.remaining() != 0; ++i)
+      {
+        size_t const v = s(sre);
+        sorted_ok = sorted_ok && (i == 0 || v > prev) && v < selected.size();
+        ++selected[v];
+        prev = v;
+      }
+    }
+    bool marginals_ok = ranges::all_of(selected,
+      [&](size_t const count)
+        { return near(count, trials, 3.0 / selected.size()); });
+
+    // region_sample_iterator's regions end at the smallest k-1 of k values
+    // sampled from [1,n], e.g., for n=3 and 2 regions the first region is
+    // [0,1) with probability 2/3...
+    size_t first_is_one{};
+    for (size_t t{}; t != trials; ++t)
+    {
+      uwindsor_2023w::comp3400::beyond_project::region_sample_iterator
+        i{sre, size_t{3}, size_t{2}};
+      first_is_one += (i->to == 1);
+    }
+    bool regions_ok = near(first_is_one, trials, 2.0/3.0);
+
+    // project::crossover() with k points switches parents exactly k times...
+    bool points_ok = true;
+    string const a(40, '_'), b(40, 'X');
+    for (size_t k{}; k != 45; ++k)
+    {
+      auto const child = uwindsor_2023w::comp3400::project::crossover(
+        k, sre, sre, a, b
+      );
+      size_t switches{};
+      for (size_t i{1}; i != child.size(); ++i)
+        switches += (child[i] != child[i-1]);
+      points_ok = points_ok && child.size() == 40 &&
+        switches == std::min<size_t>(k, 39);
+    }
+
+    cout
+      << sorted_ok << pairs_ok << marginals_ok << regions_ok << points_ok
+      << '\n'
+    ;
+  }
+
+  // uniform_crossover() must take each element from the correct position of
+  // parent2 with probability p (else parent1), copy the longer parent's
+  // tail, and give the same child for every kind of output iterator given
+  // the same URBG state...
+  {
+    using uwindsor_2023w::comp3400::beyond_project::uniform_crossover;
+
+    default_random_engine ure{3400};
+    size_t const n = 1'000'001;  // not a multiple of the SIMD width
+    string a(n, '\0'), b(n-7, '\0');
+    uniform_int_distribution<int> byte('a', 'z');
+    for (auto& c : a)
+      c = static_cast<char>(byte(ure));
+    for (auto& c : b)
+      c = static_cast<char>(byte(ure) - 'a' + 'A');
+
+    bool positions_ok = true, rates_ok = true;
+    for (double const p : { 0.1, 0.5, 0.9 })
+    {
+      string child;
+      uniform_crossover(a, b, back_inserter(child), ure, p);
+      size_t from_b{};
+      for (size_t i{}; i != b.size(); ++i)
+      {
+        positions_ok = positions_ok && (child[i] == a[i] || child[i] == b[i]);
+        from_b += (child[i] == b[i]);
+      }
+      positions_ok = positions_ok && child.size() == n &&
+        child.substr(b.size()) == a.substr(b.size());
+      double const sd = sqrt(b.size()*p*(1.0-p));
+      rates_ok = rates_ok &&
+        abs(static_cast<double>(from_b) - b.size()*p) <= 5.0*sd;
+    }
+
+    string via_inserter, via_pointer(n, '\0');
+    default_random_engine re1{1}, re2{1};
+    uniform_crossover(a, b, back_inserter(via_inserter), re1, 0.3);
+    uniform_crossover(a, b, via_pointer.data(), re2, 0.3);
+    bool outputs_ok = via_inserter == via_pointer;
+
+    // Non-contiguous parents (and the p == 0 and p == 1 shortcuts)...
+    forward_list<char> const fa(a.begin(), a.begin()+100);
+    list<char> const lb(b.begin(), b.begin()+90);
+    string child, none, all;
+    uniform_crossover(fa, lb, back_inserter(child), ure, 0.5);
+    uniform_crossover(fa, lb, back_inserter(none), ure, 0.0);
+    uniform_crossover(fa, lb, back_inserter(all), ure, 1.0, false);
+    bool generic_ok = child.size() == 100 &&
+      child.substr(90) == a.substr(90, 10) &&
+      none == a.substr(0, 100) && all == b.substr(0, 90);
+    for (size_t i{}; i != 90; ++i)
+      generic_ok = generic_ok && (child[i] == a[i] || child[i] == b[i]);
+
+    cout << positions_ok << rates_ok << outputs_ok << generic_ok << '\n';
+  }
+
+  // beyond_project::crossover() copies segments with memcpy, a container's
+  // range insert, or a single pass over both parents depending on the
+  // parent and output types --all of which must produce the same child
+  // given the same URBG states...
+  {
+    using uwindsor_2023w::comp3400::beyond_project::crossover;
+
+    string const a(50, '_'), b(60, 'X');
+    forward_list<char> const fa(a.begin(), a.end());
+    list<char> const lb(b.begin(), b.end());
+    vector<char> const vb(b.begin(), b.end());
+
+    auto const child_of =
+      [](size_t const k, unsigned const seed, auto const& p1, auto const& p2,
+        auto out)
+      {
+        default_random_engine re1{seed}, re2{seed+1};
+        return crossover(k, re1, re2, p1, p2, out);
+      }
+    ;
+
+    bool same_ok = true;
+    for (size_t k{}; k != 12; ++k)
+      for (unsigned seed{}; seed != 20; ++seed)
+      {
+        string s1, s2, s3, s4(b.size(), '\0');
+        vector<char> v5;
+        child_of(k, seed, a, b, back_inserter(s1));
+        child_of(k, seed, fa, lb, back_inserter(s2));
+        child_of(k, seed, fa, vb, back_inserter(s3));
+        s4.resize(static_cast<size_t>(
+          child_of(k, seed, a, b, s4.data()) - s4.data()
+        ));
+        child_of(k, seed, a, vb, back_inserter(v5));
+        same_ok = same_ok && s1 == s2 && s1 == s3 && s1 == s4 &&
+          s1 == string(v5.begin(), v5.end());
+      }
+    cout << same_ok << '\n';
+  }
 }
 
 //=============================================================================
@@ -0,0 +1,124 @@
+//=============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "evolver.hpp"
+
+//=============================================================================
+
+// Always selects the fittest individual...
+struct pick_best
+{
+  template <typename URBG>
+  std::size_t operator()(std::span<std::size_t const> const fitness, URBG&&)
+    const
+  {
+    return static_cast<std::size_t>(
+      std::ranges::min_element(fitness) - fitness.begin()
+    );
+  }
+};
+
+// The number of positions where individual differs from target...
+struct mismatches
+{
+  std::size_t operator()(
+    std::vector<char> const& target,
+    std::vector<char> const& individual
+  ) const
+  {
+    std::size_t retval{};
+    for (std::size_t i{}; i != target.size(); ++i)
+      retval += (target[i] != individual[i]);
+    return retval;
+  }
+};
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  {
+    string const target{ "To be or not to be." };
+    evolver_options options;
+    options.population_size = 300;
+    options.mutation_rate = 0.05;
+    options.elites = 2;
+    evolver<string> ev(target, options);
+
+    // The elites make the best fitness non-increasing...
+    bool non_increasing = true;
+    size_t best = ev.stats().best_fitness;
+    for (int i{}; i != 100; ++i)
+    {
+      auto const& s = ev.step();
+      non_increasing = non_increasing && s.best_fitness <= best;
+      best = s.best_fitness;
+    }
+    auto const& s = ev.run(stop_at_fitness{0});
+
+    cout
+      << non_increasing
+      << (s.best_fitness == 0)
+      << (ev.best() == target)
+      << (ev.population().size() == options.population_size)
+      << (ranges::all_of(ev.population(),
+           [&](string const& i) { return i.size() == target.size(); }))
+      << (s.evaluations ==
+           options.population_size +
+           s.generation*(options.population_size - options.elites))
+      << (ev.fitness()[s.best_index] == 0)
+      << (s.generations_per_second() > 0.0)
+      << '\n'
+    ;
+  }
+
+  {
+    // Custom selection and fitness function types can be used...
+    vector<char> const target{ 'a', 'b', 'c', 'd' };
+    evolver_options options;
+    options.population_size = 50;
+    options.mutation_rate = 0.25;
+    evolver<vector<char>, pick_best, mismatches> ev(target, options);
+    ev.run(stop_after_generations{20});
+    cout
+      << (ev.stats().generation == 20)
+      << (ev.fitness()[ev.stats().best_index] ==
+           mismatches{}(target, ev.best()))
+      << '\n'
+    ;
+  }
+
+  {
+    // Runs are reproducible: the same seed gives bit-identical populations
+    // for any number of threads...
+    string const target{ "Methinks it is like a weasel." };
+    evolver_options options;
+    options.population_size = 500;
+    options.evaluation_chunk = 16;
+    options.seed = 42;
+    evolver<string> serial(target, options);
+    options.threads = 3;
+    evolver<string> parallel(target, options);
+    options.seed = 43;
+    evolver<string> other(target, options);
+    serial.run(stop_after_generations{30});
+    parallel.run(stop_after_generations{30});
+    other.run(stop_after_generations{30});
+    cout
+      << (serial.population() == parallel.population())
+      << ranges::equal(serial.fitness(), parallel.fitness())
+      << (serial.population() != other.population())
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
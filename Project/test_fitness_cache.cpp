@@ -0,0 +1,130 @@
+//=============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "evolver.hpp"
+#include "fitness_cache.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  {
+    // Hashes depend only on the contents (and length)...
+    string const a{ "To be or not to be." };
+    vector<char> const va(a.begin(), a.end());
+    list<char> const la(a.begin(), a.end());
+    cout
+      << (fitness_cache::hash(a) == fitness_cache::hash(va))
+      << (fitness_cache::hash(la) == fitness_cache::hash(list<char>(la)))
+      << (fitness_cache::hash(a) != fitness_cache::hash(string{"To be"}))
+      << (fitness_cache::hash(string(17, '\0')) !=
+           fitness_cache::hash(string(18, '\0')))
+      << '\n'
+    ;
+  }
+
+  {
+    fitness_cache cache(1024);
+    size_t computed{};
+    auto const length = [&](string const& s) { ++computed; return s.size(); };
+    bool values_ok =
+      cache.get_or_compute(string{"abc"}, length) == 3 &&
+      cache.get_or_compute(string{"abcd"}, length) == 4 &&
+      cache.get_or_compute(string{"abc"}, length) == 3 &&
+      cache.get_or_compute(string{"abc"}, length) == 3;
+    cout
+      << values_ok << (computed == 2) << (cache.hits() == 2)
+      << (cache.misses() == 2) << (cache.capacity() == 1024)
+      << '\n'
+    ;
+  }
+
+  {
+    // The cache is bounded...
+    fitness_cache cache(256);
+    for (uint64_t k{1}; k <= 100'000; ++k)
+      cache.insert(k*0x9E3779B97F4A7C15ULL, k);
+    size_t found{};
+    for (uint64_t k{1}; k <= 100'000; ++k)
+      if (auto const v = cache.find(k*0x9E3779B97F4A7C15ULL))
+        found += (*v == k);
+    bool bounded_ok = found > 0 && found <= cache.capacity();
+
+    // CLOCK eviction gives entries that were hit a second chance, e.g., with
+    // one bucket keys 1 and 2 were hit so 3 is evicted by 5...
+    fitness_cache one_bucket(fitness_cache::ways);
+    for (uint64_t k{1}; k <= 4; ++k)
+      one_bucket.insert(k, k*10);
+    one_bucket.find(1);
+    one_bucket.find(2);
+    one_bucket.insert(5, 50);
+    bool clock_ok =
+      one_bucket.find(1) == 10 && one_bucket.find(2) == 20 &&
+      !one_bucket.find(3) && one_bucket.find(4) == 40 &&
+      one_bucket.find(5) == 50;
+    cout << bounded_ok << clock_ok << '\n';
+  }
+
+  {
+    // Concurrent lookups and insertions never return a wrong value...
+    fitness_cache cache(512);
+    atomic<bool> ok{true};
+    size_t const nthreads = 4, ncalls = 200'000;
+    vector<thread> threads;
+    for (size_t t{}; t != nthreads; ++t)
+      threads.emplace_back(
+        [&, t]()
+        {
+          for (size_t i{}; i != ncalls; ++i)
+          {
+            uint64_t const k = (i * 7919 + t) % 2000 + 1;
+            size_t const v = cache.get_or_compute(to_string(k),
+              [](string const& s) { return stoul(s) * 3; });
+            if (v != k*3)
+              ok = false;
+          }
+        }
+      );
+    for (auto& t : threads)
+      t.join();
+    cout << ok << (cache.hits() + cache.misses() == nthreads*ncalls) << '\n';
+  }
+
+  {
+    // An evolver using cached_fitness evolves exactly the same population as
+    // one using levenshtein_fitness (while skipping duplicate evaluations)...
+    string const target{ "Methinks it is like a weasel." };
+    evolver_options options;
+    options.population_size = 500;
+    options.threads = 2;
+
+    evolver<string> plain(target, options);
+    evolver<string, binary_tournament_selection, cached_fitness<>> cached(
+      target, options
+    );
+    plain.run(stop_after_generations{100});
+    cached.run(stop_after_generations{100});
+
+    auto const& cache = cached.fitness_function().cache();
+    cout
+      << (plain.population() == cached.population())
+      << ranges::equal(plain.fitness(), cached.fitness())
+      << (cache.hits() > 0)
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
@@ -0,0 +1,196 @@
+//=============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "gap_buffer.hpp"
+#include "project.hpp"
+#include "beyond_project.hpp"
+#include "evolver.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+  namespace bp = uwindsor_2023w::comp3400::beyond_project;
+  using buffer = gap_buffer<char>;
+
+  static_assert(ranges::random_access_range<buffer>);
+  static_assert(ranges::random_access_range<buffer const>);
+  static_assert(ranges::sized_range<buffer>);
+  static_assert(back_insertable<buffer>);
+  static_assert(indel_editable<buffer>);
+  static_assert(indel_editable<string>);
+  static_assert(indel_editable<list<int>>);
+
+  {
+    // Edits anywhere give the same results as the same edits of a string...
+    mt19937 urbg(3400);
+    buffer b;
+    string s;
+    bool same = true;
+    for (size_t k{}; k != 10'000; ++k)
+    {
+      size_t const pos = uniform_int_distribution<size_t>(0, s.size())(urbg);
+      char const c = static_cast<char>('a' + urbg() % 26);
+      switch (urbg() % 4)
+      {
+        case 0:
+          b.push_back(c);
+          s.push_back(c);
+          break;
+        case 1:
+          if (pos != s.size())
+          {
+            b.erase(b.begin() + static_cast<ptrdiff_t>(pos));
+            s.erase(s.begin() + static_cast<ptrdiff_t>(pos));
+            break;
+          }
+          [[fallthrough]];
+        default:
+          b.insert(b.begin() + static_cast<ptrdiff_t>(pos), c);
+          s.insert(s.begin() + static_cast<ptrdiff_t>(pos), c);
+          break;
+      }
+      same = same && b.size() == s.size();
+    }
+    same = same && ranges::equal(b, s);
+
+    string const r{ "range" };
+    b.insert(b.begin() + 3, r.begin(), r.end());
+    s.insert(3, r);
+    b.erase(b.begin() + 1, b.begin() + 4);
+    s.erase(1, 3);
+
+    buffer c(s.begin(), s.end());
+    cout
+      << same
+      << ranges::equal(b, s)
+      << (b == c)
+      << (b.cursor() == 1)
+      << (b.capacity() >= b.size())
+      << (buffer{ 'a', 'b' }.back() == 'b')
+      << '\n'
+    ;
+  }
+
+  {
+    // It works with levenshtein(), mutate_geometric(), and both
+    // crossover()s...
+    string const target{ "To be or not to be." };
+    string const other{ "Two bee oar knot too bee!" };
+    buffer const bt(target.begin(), target.end());
+    buffer bo(other.begin(), other.end());
+    bo.insert(bo.begin() + 5, 'x');
+    bo.erase(bo.begin() + 5);
+
+    mt19937 urbg1(1), urbg2(1);
+    buffer child1;
+    string child2;
+    bp::crossover(3, urbg1, urbg1, bt, bo, back_inserter(child1));
+    bp::crossover(3, urbg2, urbg2, target, other, back_inserter(child2));
+    buffer const child3 = crossover(2, urbg1, urbg1, bt, bo);
+    string const child4 = crossover(2, urbg2, urbg2, target, other);
+
+    stateless_char_mutator m;
+    buffer mb = bo;
+    string ms = other;
+    mutate_geometric(mb, 0.3, m.bind(urbg1), urbg1);
+    mutate_geometric(ms, 0.3, m.bind(urbg2), urbg2);
+
+    cout
+      << (levenshtein(bt, bo) == levenshtein(target, other))
+      << ranges::equal(child1, child2)
+      << ranges::equal(child3, child4)
+      << ranges::equal(mb, ms)
+      << '\n'
+    ;
+  }
+
+  {
+    // mutate_indel() changes lengths, edits a gap_buffer as it does a string
+    // (and a list), and a rate of 0 does nothing...
+    string const target(1000, '.');
+    auto const marker = [](char) { return '#'; };
+    mt19937 urbg1(7), urbg2(7), urbg3(7);
+    buffer b(target.begin(), target.end());
+    string s = target;
+    list<char> l(target.begin(), target.end());
+    mutate_indel(b, 0.05, marker, urbg1);
+    mutate_indel(s, 0.05, marker, urbg2);
+    mutate_indel(l, 0.05, marker, urbg3);
+
+    stateless_char_mutator m;
+    string unchanged = target;
+    mutate_indel(unchanged, 0.0, m.bind(urbg1), urbg1);
+
+    // Every edit is one insertion (of a '#') or one erasure (an adjacent
+    // pair of which levenshtein() may count as one substitution)...
+    size_t const insertions = static_cast<size_t>(ranges::count(s, '#'));
+    size_t const erasures = target.size() + insertions - s.size();
+
+    // ... and a rate of 1 edits every position (and appends)...
+    string e;
+    mutate_indel(e, 1.0, marker, urbg1);
+    string all = target;
+    mutate_indel(all, 1.0, marker, urbg1);
+    size_t const all_insertions = static_cast<size_t>(ranges::count(all, '#'));
+
+    cout
+      << ranges::equal(b, s)
+      << ranges::equal(l, s)
+      << (s != target)
+      << (levenshtein(s, target) <= insertions + erasures)
+      << (levenshtein(s, target) >= insertions)
+      << (unchanged == target)
+      << (e == "#")
+      << (all_insertions - 1 + (target.size() + all_insertions - all.size())
+        == target.size())
+      << (all.back() == '#')
+      << '\n'
+    ;
+  }
+
+  {
+    // An evolver of gap_buffer individuals reaches the target and, with an
+    // indel_rate, its individuals' lengths vary...
+    string const target{ "To be or not to be." };
+    evolver_options options;
+    options.population_size = 200;
+    options.mutation_rate = 0.02;
+
+    auto const lengths_vary =
+      [&](auto const& ev)
+      {
+        return ranges::any_of(ev.population(),
+          [&](buffer const& i) { return i.size() != target.size(); });
+      }
+    ;
+
+    evolver<buffer> ev(target, options);
+    auto const s = ev.run(stop_at_fitness{0});
+    options.indel_rate = 0.02;
+    evolver<buffer> ev2(target, options);
+    auto const s2 = ev2.run(stop_at_fitness{0});
+    cout
+      << (s.best_fitness == 0)
+      << ranges::equal(ev.best(), target)
+      << !lengths_vary(ev)
+      << (s2.best_fitness == 0)
+      << ranges::equal(ev2.best(), target)
+      << lengths_vary(ev2)
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
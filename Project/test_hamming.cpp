@@ -0,0 +1,140 @@
+//=============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "project.hpp"
+#include "population.hpp"
+#include "evolver.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  {
+    cout
+      << (hamming("karolin"s, "kathrin"s) == 3)
+      << (hamming("1011101"s, "1001001"s) == 2)
+      << (hamming(""s, ""s) == 0)
+      << (hamming("abc"s, "abcde"s) == 2)
+      << (hamming("xbc"s, "abcde"s) == 3)
+      << (hamming(vector{1,2,3}, vector{1,5,3}) == 1)
+      << (hamming(list{'a','b'}, list{'b','b','c'}) == 2)
+      << '\n'
+    ;
+
+    // It is not levenshtein(): the two can rank individuals oppositely...
+    cout
+      << (hamming("abcdef"s, "bcdefa"s) == 6)
+      << (levenshtein("abcdef"s, "bcdefa"s) == 2)
+      << (hamming("abcdef"s, "abcxyz"s) == 3)
+      << (levenshtein("abcdef"s, "abcxyz"s) == 3)
+      << '\n'
+    ;
+  }
+
+  {
+    // Random strings of many lengths (so every block size and tail is used)
+    // give the same distances as a simple count with every kernel, and the
+    // distance is never less than the Levenshtein distance...
+    mt19937 urbg(3400);
+    bool same = true;
+    bool scalar_same = true;
+    bool bounded = true;
+    for (size_t n{}; n != 300; ++n)
+    {
+      string a(n, ' ');
+      for (auto& c : a)
+        c = static_cast<char>('a' + urbg() % 4);
+      string b = a;
+      for (auto& c : b)
+        if (urbg() % 5 == 0)
+          c = static_cast<char>('a' + urbg() % 4);
+      if (n % 7 == 0)
+        b.append(n % 3, 'z');
+
+      size_t expected = a.size() < b.size() ? b.size()-a.size() : 0;
+      for (size_t i{}; i != std::min(a.size(), b.size()); ++i)
+        expected += a[i] != b[i];
+
+      size_t const common = std::min(a.size(), b.size());
+      size_t const d = hamming(a, b);
+      same = same && d == expected && hamming(b, a) == expected;
+      scalar_same = scalar_same &&
+        detail::hamming_bytes_scalar(
+          reinterpret_cast<unsigned char const*>(a.data()),
+          reinterpret_cast<unsigned char const*>(b.data()), common
+        ) + (b.size()-common) == expected;
+      bounded = bounded && d >= levenshtein(a, b);
+    }
+    cout << same << scalar_same << bounded << '\n';
+  }
+
+  {
+    // hamming_batch() of an arena_population (the padded-slot kernel) and of
+    // a vector give the same distances as hamming()...
+    mt19937 urbg(1);
+    string const target{ "To be or not to be, that is the question." };
+    vector<string> individuals;
+    for (size_t i{}; i != 50; ++i)
+    {
+      string s = target.substr(0, target.size() - i % 5);
+      for (auto& c : s)
+        if (urbg() % 3 == 0)
+          c = static_cast<char>(' ' + urbg() % 95);
+      if (i % 11 == 0)
+        s += "!!!";
+      individuals.push_back(s);
+    }
+    arena_population<char> const pop(individuals);
+
+    vector<size_t> expected;
+    for (auto const& i : individuals)
+      expected.push_back(hamming(target, i));
+    vector<size_t> from_arena, from_vector;
+    hamming_batch(target, pop, back_inserter(from_arena));
+    hamming_batch(target, individuals, back_inserter(from_vector));
+
+    vector<size_t> short_target;
+    hamming_batch("To"s, pop, back_inserter(short_target));
+    bool short_same = true;
+    for (size_t i{}; i != individuals.size(); ++i)
+      short_same = short_same &&
+        short_target[i] == hamming("To"s, individuals[i]);
+
+    cout
+      << (from_arena == expected)
+      << (from_vector == expected)
+      << short_same
+      << '\n'
+    ;
+  }
+
+  {
+    // hamming_fitness can be used wherever levenshtein_fitness is...
+    string const target{ "To be or not to be." };
+    evolver_options options;
+    options.population_size = 200;
+    options.mutation_rate = 0.02;
+    evolver<string, binary_tournament_selection, hamming_fitness> ev(
+      target, options
+    );
+    auto const s = ev.run(stop_at_fitness{0});
+    cout
+      << (s.best_fitness == 0)
+      << (ev.best() == target)
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
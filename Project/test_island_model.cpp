@@ -0,0 +1,102 @@
+//=============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "island_model.hpp"
+#include "spsc_queue.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  {
+    // Elements arrive in order between one producer and one consumer...
+    spsc_queue<int> q(100);
+    int const n = 100'000;
+    thread producer(
+      [&]()
+      {
+        for (int i{}; i != n;)
+          if (q.try_push(i))
+            ++i;
+      }
+    );
+    bool in_order = true;
+    for (int expected{}; expected != n;)
+    {
+      int value;
+      if (q.try_pop(value))
+      {
+        in_order = in_order && value == expected;
+        ++expected;
+      }
+    }
+    producer.join();
+
+    spsc_queue<string> full(2);
+    int dummy;
+    spsc_queue<int> empty(1);
+    cout
+      << in_order
+      << (q.capacity() == 128)
+      << full.try_push("a"s) << full.try_push("b"s) << !full.try_push("c"s)
+      << !empty.try_pop(dummy)
+      << '\n'
+    ;
+  }
+
+  {
+    string const target{ "To be or not to be." };
+    evolver_options options;
+    options.population_size = 100;
+    options.mutation_rate = 0.05;
+    options.elites = 1;
+
+    for (auto const topology : { migration_topology::ring,
+      migration_topology::random })
+    {
+      island_options islands;
+      islands.islands = 4;
+      islands.migration_interval = 5;
+      islands.migrants = 2;
+      islands.topology = topology;
+      island_model<string> model(target, options, islands);
+      auto const s = model.run(stop_at_fitness{0});
+
+      size_t generations{};
+      for (size_t i{}; i != model.size(); ++i)
+        generations += model.island(i).stats().generation;
+      cout
+        << (s.best_fitness == 0)
+        << (model.best() == target)
+        << (model.size() == 4)
+        << (s.generation == generations)
+        << '\n'
+      ;
+    }
+
+    // The first island to be done stops all islands...
+    island_options islands;
+    islands.islands = 3;
+    island_model<string> model(target, options, islands);
+    model.run(stop_after_generations{7});
+    size_t max_generation{};
+    for (size_t i{}; i != model.size(); ++i)
+      max_generation =
+        std::max(max_generation, model.island(i).stats().generation);
+    cout
+      << (max_generation == 7)
+      << (model.stats().generation <= 21)
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
@@ -1,7 +1,11 @@
 //=============================================================================
 
+#include <algorithm>
 #include <array>
 #include <iostream>
+#include <optional>
+#include <random>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -58,6 +62,247 @@ int main()
       << (levenshtein(vector{'V','s','a','u','c','e'}, "apple sauce"s) == 6)
       << '\n'
     ;
+
+    // Strings longer than 64 characters use multiple bit-parallel blocks...
+    string const a100(100, 'a');
+    string const b100(100, 'b');
+    string const a70x = string(70, 'a') + 'x';
+    cout
+      << (levenshtein(a100, b100) == 100)
+      << (levenshtein(a100, a100) == 0)
+      << (levenshtein(a70x, string(70, 'a')) == 1)
+      << (levenshtein(string(64, 'a'), string(65, 'a')) == 1)
+      << (levenshtein(a100 + "kitten" + b100, a100 + "sitting" + b100) == 3)
+      << (levenshtein(b100, "") == 100)
+      << '\n'
+    ;
+
+    // Long 16- and 32-bit element ranges use the anti-diagonal SIMD kernel...
+    u16string const u1000(1000, u'α');
+    vector<int> const v1000(1000, 7);
+    vector<int> v999x = v1000;
+    v999x[500] = 8;
+    v999x.pop_back();
+    cout
+      << (levenshtein(u1000, u1000 + u"kitten") == 6)
+      << (levenshtein(u1000 + u"kitten", u1000 + u"sitting") == 3)
+      << (levenshtein(v1000, v999x) == 2)
+      << (levenshtein(v1000, vector<int>(1000, 8)) == 1000)
+      << '\n'
+    ;
+
+    // Ranges with a compile-time size (arrays, C-style string literals,
+    // fixed-extent spans) can be used in constant expressions...
+    static_assert(levenshtein("kitten", "sitting") == 3);
+    static_assert(levenshtein("", "abc") == 3);
+    static_assert(levenshtein(array{1,2,3,4}, array{4,3,2,1}) == 4);
+    static_assert(levenshtein(array<int,0>{}, array{1,2}) == 2);
+    array<char,70> a70;
+    a70.fill('a');
+    cout
+      << (levenshtein(a70, a100) == 30)
+      << (levenshtein(a100 + "kitten", array{'k','i','t','t','e','n'}) == 100)
+      << (levenshtein(span<int const,1000>(v1000), v999x) == 2)
+      << (levenshtein(array{1,2,3,4}, vector{1,3,4}) == 1)
+      << '\n'
+    ;
+  }
+
+  {
+    using uwindsor_2023w::comp3400::project::levenshtein;
+
+    // A plain two-row dynamic programming Levenshtein distance...
+    auto const reference =
+      [](auto const& a, auto const& b)
+      {
+        vector<size_t> prev(b.size()+1), cur(b.size()+1);
+        for (size_t j{}; j != prev.size(); ++j)
+          prev[j] = j;
+        for (size_t i{}; i != a.size(); ++i)
+        {
+          cur[0] = i+1;
+          for (size_t j{}; j != b.size(); ++j)
+            cur[j+1] = std::min({
+              prev[j+1] + 1, cur[j] + 1, prev[j] + (a[i] != b[j])
+            });
+          swap(prev, cur);
+        }
+        return prev.back();
+      }
+    ;
+
+    // Random strings of lengths 0 to 300 (including both sides of every
+    // 64-bit block boundary), either unrelated or edited copies of each other,
+    // give the reference distance in both argument orders...
+    mt19937 urbg(3400);
+    auto const random_string =
+      [&](size_t const n, size_t const alphabet)
+      {
+        string retval(n, ' ');
+        for (auto& c : retval)
+          c = static_cast<char>('a' + urbg() % alphabet);
+        return retval;
+      }
+    ;
+    auto const edited =
+      [&](string s, size_t const alphabet)
+      {
+        for (size_t k = urbg() % 20; k != 0; --k)
+        {
+          size_t const pos = s.empty() ? 0 : urbg() % s.size();
+          char const c = static_cast<char>('a' + urbg() % alphabet);
+          switch (urbg() % 3)
+          {
+            case 0:
+              if (!s.empty())
+              {
+                s[pos] = c;
+                break;
+              }
+              [[fallthrough]];
+            case 1:
+              s.insert(s.begin() + static_cast<ptrdiff_t>(pos), c);
+              break;
+            default:
+              if (!s.empty())
+                s.erase(s.begin() + static_cast<ptrdiff_t>(pos));
+              break;
+          }
+        }
+        return s;
+      }
+    ;
+
+    vector<size_t> lengths{ 0, 1, 63, 64, 65, 127, 128, 129, 255, 256, 257 };
+    for (size_t k{}; k != 20; ++k)
+      lengths.push_back(urbg() % 301);
+
+    bool same = true;
+    for (size_t const n : lengths)
+      for (size_t const m : lengths)
+        for (size_t const alphabet : { 4, 26 })
+        {
+          string const a = random_string(n, alphabet);
+          string const b = random_string(m, alphabet);
+          size_t const d = reference(a, b);
+          same = same && levenshtein(a, b) == d && levenshtein(b, a) == d;
+        }
+
+    bool edited_same = true;
+    for (size_t n{}; n <= 300; ++n)
+    {
+      string const a = random_string(n, 4);
+      string const b = edited(a, 4);
+      size_t const d = reference(a, b);
+      edited_same = edited_same &&
+        levenshtein(a, b) == d && levenshtein(b, a) == d;
+    }
+    cout << same << edited_same << '\n';
+  }
+
+  {
+    using uwindsor_2023w::comp3400::project::levenshtein_within;
+
+    // levenshtein_within(a,b,k) returns std::nullopt if the distance is > k...
+    string const a100(100, 'a');
+    cout
+      << (levenshtein_within("kitten"s, "sitting"s, 3) == 3u)
+      << (!levenshtein_within("kitten"s, "sitting"s, 2))
+      << (levenshtein_within("house"s, "mouse"s, 10) == 1u)
+      << (!levenshtein_within("abc"s, "abcdef"s, 2))
+      << (levenshtein_within(a100 + "kitten", a100 + "sitting", 3) == 3u)
+      << (!levenshtein_within(a100 + "kitten", a100 + "sitting", 2))
+      << (levenshtein_within(wstring{L"αβδε"}, wstring{L"αβ_δε"}, 1) == 1u)
+      << (!levenshtein_within(vector{1,2,3,4}, vector{4,3,2,1}, 3))
+      << (levenshtein_within(vector{1,2,3,4}, vector{4,3,2,1}, 4) == 4u)
+      << '\n'
+    ;
+  }
+
+  {
+    using uwindsor_2023w::comp3400::project::levenshtein;
+    using uwindsor_2023w::comp3400::project::levenshtein_batch;
+
+    // levenshtein_batch(target,population,out) computes the same distances
+    // as calling levenshtein(target,individual) for each individual...
+    string const target = "To be or not to be."s;
+    vector<string> population{
+      "To be or not to be."s, "to be or not to be?"s, "To be or not"s, ""s,
+      "Xo be or noX to be."s, string(70, 'T'), "be."s, "To be or not to be!!"s,
+      "o be or not to be."s
+    };
+    auto const correct =
+      [&](auto const& distances)
+      {
+        return ranges::equal(
+          distances, population, {}, {},
+          [&](auto const& individual) { return levenshtein(target, individual); }
+        );
+      }
+    ;
+
+    vector<size_t> d1;
+    levenshtein_batch(target, population, back_inserter(d1));
+    vector<size_t> d2(population.size());
+    levenshtein_batch(target, population, d2.begin(), 3);
+    vector<size_t> d3;
+    levenshtein_batch(string(200, 'T'), population, back_inserter(d3));
+    vector<size_t> d4;
+    levenshtein_batch(
+      wstring{L"αβδε"}, vector{wstring{L"αβ_δε"}, wstring{}}, back_inserter(d4)
+    );
+
+    // levenshtein_prefix_shared(target,population,out) also computes the same
+    // distances (sharing the work of common prefixes)...
+    using uwindsor_2023w::comp3400::project::levenshtein_prefix_shared;
+    vector<size_t> d5;
+    levenshtein_prefix_shared(target, population, back_inserter(d5));
+    vector<size_t> d6;
+    levenshtein_prefix_shared(string(200, 'T'), population, back_inserter(d6));
+    vector<size_t> d7;
+    levenshtein_prefix_shared(
+      vector{1,2,3}, vector<vector<int>>{{1,2,3},{1,2},{},{1,2,4,5}}, 
+      back_inserter(d7)
+    );
+    cout
+      << correct(d1)
+      << correct(d2)
+      << (d3[0] == 199 && d3[5] == 130)
+      << (d4 == vector<size_t>{1, 4})
+      << correct(d5)
+      << (d6 == d3)
+      << (d7 == vector<size_t>{0, 1, 3, 2})
+      << '\n'
+    ;
+  }
+
+  {
+    using uwindsor_2023w::comp3400::project::levenshtein;
+    using uwindsor_2023w::comp3400::project::incremental_levenshtein;
+    using uwindsor_2023w::comp3400::project::mutate_reporting_first;
+    using uwindsor_2023w::comp3400::project::char_mutator;
+
+    // incremental_levenshtein only recomputes the DP rows from the first
+    // mutated element onwards...
+    string const target = "Methinks it is like a weasel."s;
+    string individual = "Methinks it is like a weasel!"s;
+    incremental_levenshtein<char> eval(target, 4);
+    bool all_same = (eval.assign(individual) == 1);
+
+    char_mutator m;
+    default_random_engine re{3400};
+    for (int i{}; i != 100; ++i)
+    {
+      if (auto const first = mutate_reporting_first(individual, 0.05, m, re))
+        eval.update(individual, *first);
+      all_same = all_same && (eval.distance() == levenshtein(target, individual));
+    }
+    individual.resize(10);
+    cout 
+      << all_same
+      << (eval.update(individual, 0) == levenshtein(target, individual))
+      << '\n'
+    ;
   }
 
 #ifdef ALTERNATIVE_LEVENSHTEIN_IMPLEMENTATION
@@ -95,12 +340,119 @@ int main()
       << (levenshtein(kitten_us, sitting_us) == 2)
       << '\n'
     ;
-    // 
-    // Other things that could be done:
-    //   * If both arguments were sized_ranges, one could ensure the shortest 
-    //     range is always the second argument to keep the std::vector objects 
-    //     small (and therefore the amount of work done smaller).
+
+    //
+    // A levenshtein_workspace can be passed in to reuse the same scratch
+    // memory over many calls (otherwise a thread_local one is used)...
+    //
+    uwindsor_2023w::comp3400::project::levenshtein_workspace ws;
+    cout
+      << (levenshtein(kitten_fl, sitting_l, ws) == 3)
+      << (levenshtein(wstring{L"αβδε"}, list<wchar_t>{L'α',L'β'}, ws) == 2)
+      << (levenshtein(vector{1,2,3}, forward_list{1,3}, ws) == 1)
+      << '\n'
+    ;
+
+    //
+    // levenshtein_alignment() writes the edit script (in linear space)...
     //
+    using uwindsor_2023w::comp3400::beyond_project::levenshtein_alignment;
+    using uwindsor_2023w::comp3400::beyond_project::edit_op;
+    auto const script =
+      [](auto const& a, auto const& b)
+      {
+        string retval;
+        vector<edit_op> ops;
+        levenshtein_alignment(a, b, back_inserter(ops));
+        for (auto const& op : ops)
+          retval.push_back("=SID"[static_cast<int>(op)]);
+        return retval;
+      }
+    ;
+    auto const kitten_to_sitting = script(kitten_fl, sitting_l);
+    cout
+      << (ranges::count(kitten_to_sitting, '=') == 4)
+      << (kitten_to_sitting.size() - 4 == levenshtein(kitten, sitting))
+      << (script("abc"s, "abc"s) == "===")
+      << (script(""s, "ab"s) == "II")
+      << (script("ab"s, ""s) == "DD")
+      << (script("flaw"s, "lawn"s) == "D===I")
+      << '\n'
+    ;
+
+    // Applies an edit script to a (returning std::nullopt if the script does
+    // not fit a and b, e.g., a match of unequal elements)...
+    auto const apply =
+      [](string const& a, string const& b, vector<edit_op> const& ops)
+        -> optional<string>
+      {
+        string retval;
+        size_t i{}, j{};
+        for (auto const& op : ops)
+        {
+          bool const uses_a = op != edit_op::insert;
+          bool const uses_b = op != edit_op::erase;
+          if ((uses_a && i == a.size()) || (uses_b && j == b.size()))
+            return nullopt;
+          switch (op)
+          {
+            case edit_op::match:
+              if (a[i] != b[j])
+                return nullopt;
+              retval.push_back(a[i]);
+              break;
+            case edit_op::substitute:
+            case edit_op::insert:
+              retval.push_back(b[j]);
+              break;
+            case edit_op::erase:
+              break;
+          }
+          i += uses_a;
+          j += uses_b;
+        }
+        if (i != a.size())
+          return nullopt;
+        return retval;
+      }
+    ;
+
+    // The script for random pairs transforms a into b with levenshtein(a,b)
+    // non-match operations...
+    mt19937 urbg(8);
+    bool valid = true;
+    bool minimal = true;
+    for (size_t k{}; k != 300; ++k)
+    {
+      auto const random_string =
+        [&](size_t const n)
+        {
+          string retval(n, ' ');
+          for (auto& c : retval)
+            c = static_cast<char>('a' + urbg() % 4);
+          return retval;
+        }
+      ;
+      string const a = random_string(urbg() % (k+1));
+      string b = a;
+      if (k % 2 == 0)
+        b = random_string(urbg() % (k+1));
+      else
+        for (auto& c : b)
+          if (urbg() % 8 == 0)
+            c = static_cast<char>('a' + urbg() % 4);
+      if (k % 3 == 0)
+        b.insert(b.size()/2, random_string(urbg() % 10));
+
+      vector<edit_op> ops;
+      levenshtein_alignment(a, b, back_inserter(ops));
+      valid = valid && apply(a, b, ops) == b;
+      minimal = minimal &&
+        static_cast<size_t>(ranges::count_if(ops,
+          [](edit_op const op) { return op != edit_op::match; }
+        )) == levenshtein(a, b);
+    }
+    cout << valid << minimal << '\n';
   }
 #endif
 }
@@ -1,8 +1,13 @@
 //=============================================================================
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <forward_list>
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <span>
 #include <string>
 #include "project.hpp"
 
@@ -24,6 +29,109 @@ int main()
     mutate(str2, 0.25, m, re);
     std::cout << std::quoted(str2) << '\n';
   }
+
+  // mutate_geometric() must mutate each element with probability rate. The
+  // number of mutated elements is binomially distributed so each check
+  // allows 5 standard deviations...
+  {
+    using uwindsor_2023w::comp3400::project::mutate_geometric;
+
+    auto const flip = [](char) { return '1'; };
+    auto const near =
+      [](std::size_t const count, std::size_t const n, double const rate)
+      {
+        double const mean = n*rate;
+        double const sd = std::sqrt(n*rate*(1.0-rate));
+        return std::abs(static_cast<double>(count) - mean) <= 5.0*sd;
+      }
+    ;
+
+    std::default_random_engine gre{3400};
+    bool totals_ok = true;
+    for (double const rate : { 0.001, 0.01, 0.3 })
+    {
+      std::size_t const n = 1'000'000;
+      std::string s(n, '0');
+      mutate_geometric(s, rate, flip, gre);
+      totals_ok = totals_ok &&
+        near(static_cast<std::size_t>(std::ranges::count(s, '1')), n, rate);
+    }
+
+    // Every position is equally likely to be mutated...
+    std::size_t const trials = 40'000;
+    std::array<std::size_t,8> per_position{};
+    for (std::size_t t{}; t != trials; ++t)
+    {
+      std::string s(per_position.size(), '0');
+      mutate_geometric(s, 0.25, flip, gre);
+      for (std::size_t i{}; i != s.size(); ++i)
+        per_position[i] += (s[i] == '1');
+    }
+    bool positions_ok = std::ranges::all_of(per_position,
+      [&](std::size_t const count) { return near(count, trials, 0.25); });
+
+    // Non-random-access ranges are supported too...
+    std::forward_list<char> fl(100'000, '0');
+    mutate_geometric(fl, 0.01, flip, gre);
+    bool forward_ok = near(
+      static_cast<std::size_t>(std::ranges::count(fl, '1')), 100'000, 0.01
+    );
+
+    std::string all(10, '0'), none(10, '0');
+    mutate_geometric(all, 1.0, flip, gre);
+    mutate_geometric(none, 0.0, flip, gre);
+    std::cout
+      << totals_ok << positions_ok << forward_ok
+      << (all == std::string(10, '1')) << (none == std::string(10, '0'))
+      << '\n'
+    ;
+  }
+
+  // char_mutator::fill() must only write valid characters, each equally
+  // likely (each count is binomially distributed, 5 standard deviations are
+  // allowed), for any length (including the scalar tail after the SIMD
+  // blocks), and be reproducible given the same URBG state...
+  {
+    using uwindsor_2023w::comp3400::project::stateless_char_mutator;
+
+    std::string const valid =
+      uwindsor_2023w::comp3400::project::detail::mutation_chars();
+    std::size_t const n = 4'000'000;
+    std::string s(n, '\0');
+    std::mt19937 fre{3400};
+    m.fill(s, fre);
+    bool valid_ok = std::ranges::all_of(s,
+      [&](char const c) { return valid.find(c) != std::string::npos; });
+
+    std::array<std::size_t,256> counts{};
+    for (char const c : s)
+      ++counts[static_cast<unsigned char>(c)];
+    double const p = 1.0 / valid.size();
+    double const sd = std::sqrt(n*p*(1.0-p));
+    bool uniform_ok = std::ranges::all_of(valid,
+      [&](char const c)
+      {
+        double const count = counts[static_cast<unsigned char>(c)];
+        return std::abs(count - n*p) <= 5.0*sd;
+      }
+    );
+
+    bool lengths_ok = true;
+    for (std::size_t const len : { 0, 1, 31, 32, 33, 63, 100, 1000 })
+    {
+      std::string t(len+1, '\0');
+      m.fill(std::span<char>(t.data(), len), fre);
+      lengths_ok = lengths_ok && t[len] == '\0' &&
+        std::ranges::all_of(t.substr(0, len),
+          [&](char const c) { return valid.find(c) != std::string::npos; });
+    }
+
+    std::string a(777, '\0'), b(777, '\0');
+    std::mt19937 are{1}, bre{1};
+    stateless_char_mutator{}.fill(a, are);
+    m.fill(b, bre);
+    std::cout << valid_ok << uniform_ok << lengths_ok << (a == b) << '\n';
+  }
 }
 
 //=============================================================================
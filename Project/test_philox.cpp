@@ -0,0 +1,104 @@
+//=============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "philox.hpp"
+#include "project.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  static_assert(uniform_random_bit_generator<philox4x32>);
+
+  {
+    // Known-answer tests from the Random123 distribution...
+    using counter = philox4x32::counter_type;
+    using key = philox4x32::key_type;
+    cout
+      << (philox4x32::block(counter{0,0,0,0}, key{0,0}) ==
+           counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8})
+      << (philox4x32::block(
+            counter{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+            key{0xffffffff, 0xffffffff}
+          ) == counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd})
+      << (philox4x32::block(
+            counter{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+            key{0xa4093822, 0x299f31d0}
+          ) == counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1})
+      << '\n'
+    ;
+  }
+
+  {
+    // A stream only depends on (seed, generation, index)...
+    philox4x32 a(3400, 7, 11), b(3400, 7, 11), c(3400, 7, 12), d(3400, 8, 11);
+    vector<philox4x32::result_type> av(10), bv(10), cv(10), dv(10);
+    ranges::generate(av, ref(a));
+    ranges::generate(bv, ref(b));
+    ranges::generate(cv, ref(c));
+    ranges::generate(dv, ref(d));
+
+    philox4x32 e(3400, 7, 11);
+    e.discard(6);
+    philox4x32 f(3400, 7, 11);
+    f();
+    f.discard(4);
+    cout
+      << (av == bv) << (a == b)
+      << (av != cv) << (av != dv) << (cv != dv)
+      << (e() == av[6]) << (f() == av[5])
+      << '\n'
+    ;
+  }
+
+  {
+    // stateless_char_mutator is reproducible and can be used concurrently
+    // with one generator per individual...
+    stateless_char_mutator const m;
+    auto const make =
+      [&](size_t const index)
+      {
+        philox4x32 urbg(42, 1, index);
+        string s(64, ' ');
+        mutate(s, 1.0, m.bind(urbg), urbg);
+        return s;
+      }
+    ;
+    vector<string> serial(8), parallel(8);
+    for (size_t i{}; i != serial.size(); ++i)
+      serial[i] = make(i);
+    vector<thread> threads;
+    for (size_t i{}; i != parallel.size(); ++i)
+      threads.emplace_back([&,i]() { parallel[i] = make(i); });
+    for (auto& t : threads)
+      t.join();
+
+    char_mutator const reference;
+    string const valid = [&]()
+      {
+        string retval;
+        for (int i{}; i != 10'000; ++i)
+          retval.push_back(reference());
+        return retval;
+      }()
+    ;
+    cout
+      << (serial == parallel)
+      << (serial[0] != serial[1])
+      << ranges::all_of(serial[0],
+           [&](char const ch) { return valid.find(ch) != string::npos; })
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
@@ -0,0 +1,134 @@
+//=============================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "population.hpp"
+#include "project.hpp"
+#include "beyond_project.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+  using arena = arena_population<char>;
+
+  static_assert(ranges::random_access_range<arena>);
+  static_assert(ranges::sized_range<arena>);
+  static_assert(ranges::random_access_range<arena const>);
+  static_assert(ranges::contiguous_range<ranges::range_reference_t<arena>>);
+
+  {
+    vector<string> const individuals{
+      "To be or not to be."s, "to be"s, ""s, string(100, 'x')
+    };
+    arena pop(individuals);
+    arena const& cpop = pop;
+
+    // Each individual starts on its own cache line...
+    bool aligned = true;
+    for (size_t i{}; i != pop.size(); ++i)
+      aligned = aligned &&
+        reinterpret_cast<uintptr_t>(pop[i].data()) % arena::alignment == 0;
+
+    cout
+      << (pop.size() == 4)
+      << (pop.capacity() == 100)
+      << (pop.stride() == 128)
+      << aligned
+      << ranges::equal(pop, individuals, ranges::equal_to{},
+           [](auto const& i) { return string(i.begin(), i.end()); })
+      << (cpop[1].size() == 5)
+      << (pop.fitness().size() == 4)
+      << '\n'
+    ;
+  }
+
+  {
+    // Individuals work with levenshtein(), levenshtein_batch(), mutate(),
+    // and beyond_project::crossover()...
+    string const target{ "To be or not to be." };
+    arena pop(6, target.size());
+    for (size_t i{}; i != pop.size(); ++i)
+      pop.assign(i, target);
+    pop.resize(5, 5);
+
+    char_mutator m;
+    default_random_engine re{3400};
+    auto individual = pop[0];
+    mutate(individual, 1.0, m, re);
+    pop.copy(1, 0);
+
+    auto child = pop.slot(2);
+    using uwindsor_2023w::comp3400::beyond_project::crossover;
+    auto const end = crossover(
+      2, re, re, pop[3], pop[4], child.begin()
+    );
+    pop.resize(2, static_cast<size_t>(end - child.begin()));
+
+    levenshtein_batch(target, pop, pop.fitness().begin());
+    bool all_same = true;
+    for (size_t i{}; i != pop.size(); ++i)
+      all_same = all_same && pop.fitness()[i] == levenshtein(target, pop[i]);
+
+    arena copy = pop;
+    cout
+      << (pop.fitness()[0] == levenshtein(target, pop[0]))
+      << ranges::equal(pop[0], pop[1])
+      << (pop.fitness()[5] == 14)
+      << (pop[2].size() == target.size())
+      << all_same
+      << ranges::equal(copy[0], pop[0])
+      << (copy.data() != pop.data())
+      << '\n'
+    ;
+
+    // A moved-from population is empty (and safe to iterate and reuse)...
+    arena moved(std::move(copy));
+    arena assigned;
+    assigned = std::move(moved);
+    size_t visited{};
+    for ([[maybe_unused]] auto const& i : copy)
+      ++visited;
+    for ([[maybe_unused]] auto const& i : moved)
+      ++visited;
+    bool const moved_from_empty =
+      copy.empty() && copy.size() == 0 && copy.capacity() == 0 &&
+      moved.empty() && moved.lengths().empty() && moved.fitness().empty() &&
+      visited == 0
+    ;
+    copy = pop;
+    cout
+      << moved_from_empty
+      << (assigned.size() == pop.size())
+      << ranges::equal(assigned[0], pop[0])
+      << (assigned.capacity() == pop.capacity())
+      << ranges::equal(copy[2], pop[2])
+      << '\n'
+    ;
+  }
+
+  {
+    // A population of empty individuals (which has no arena) can be copied...
+    arena empties(vector<string>(3));
+    arena const copy(empties);
+    empties.copy(0, 2);
+    cout
+      << (empties.capacity() == 0)
+      << (copy.size() == 3)
+      << ranges::all_of(copy, [](auto const& i) { return i.empty(); })
+      << empties[0].empty()
+      << '\n'
+    ;
+  }
+}
+
+//=============================================================================
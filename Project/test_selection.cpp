@@ -0,0 +1,141 @@
+//=============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "evolver.hpp"
+#include "philox.hpp"
+#include "project.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  // Each count is binomially distributed so each check allows 5 standard
+  // deviations...
+  auto const near =
+    [](size_t const count, size_t const trials, double const p)
+    {
+      double const sd = sqrt(trials*p*(1.0-p));
+      return abs(static_cast<double>(count) - trials*p) <= 5.0*sd + 1e-9;
+    }
+  ;
+  size_t const trials = 1'000'000;
+
+  {
+    // alias_table draws index i with probability weights[i]/sum(weights)...
+    array<double,6> const weights{ 1.0, 0.0, 7.5, 2.5, 0.5, 12.0 };
+    double const sum = 23.5;
+    alias_table const table(weights);
+    philox4x32 urbg(3400);
+    array<size_t,6> counts{};
+    for (size_t t{}; t != trials; ++t)
+      ++counts[table(urbg)];
+    bool weights_ok = true;
+    for (size_t i{}; i != weights.size(); ++i)
+      weights_ok = weights_ok && near(counts[i], trials, weights[i]/sum);
+
+    // Without positive weights every index is equally likely...
+    alias_table const uniform(vector<double>{ 0.0, -1.0, 0.0, NAN });
+    array<size_t,4> ucounts{};
+    for (size_t t{}; t != trials; ++t)
+      ++ucounts[uniform(urbg)];
+    bool uniform_ok = ranges::all_of(ucounts,
+      [&](size_t const c) { return near(c, trials, 0.25); });
+
+    // Rebuilding the table (e.g., once per generation) with new weights...
+    alias_table rebuilt(weights);
+    rebuilt.assign(array{ 0.0, 0.0, 1.0 });
+    bool rebuilt_ok = rebuilt.size() == 3;
+    for (size_t t{}; t != 1000; ++t)
+      rebuilt_ok = rebuilt_ok && rebuilt(urbg) == 2;
+
+    // Works with non-32-bit URBGs too...
+    mt19937_64 urbg64(3400);
+    size_t ones{};
+    for (size_t t{}; t != trials; ++t)
+      ones += (table(urbg64) == 5);
+    bool urbg_ok = near(ones, trials, 12.0/sum);
+
+    cout << weights_ok << uniform_ok << rebuilt_ok << urbg_ok << '\n';
+  }
+
+  {
+    // roulette_selection selects i with probability proportional to
+    // 1/(1+fitness[i])...
+    vector<size_t> const fitness{ 0, 1, 3, 9 };
+    double const sum = 1.0 + 1.0/2 + 1.0/4 + 1.0/10;
+    roulette_selection roulette;
+    roulette.prepare(fitness);
+    philox4x32 urbg(3401);
+    array<size_t,4> counts{};
+    for (size_t t{}; t != trials; ++t)
+      ++counts[roulette(fitness, urbg)];
+    bool roulette_ok = true;
+    for (size_t i{}; i != fitness.size(); ++i)
+      roulette_ok = roulette_ok &&
+        near(counts[i], trials, 1.0/(1.0+fitness[i])/sum);
+
+    // tournament_selection of size k selects the individual of rank r (0 is
+    // the fittest) of n distinct fitness values with probability
+    // ((n-r)^k - (n-r-1)^k) / n^k...
+    vector<size_t> const distinct{ 40, 10, 30, 0, 20 };
+    bool tournament_ok = true;
+    for (size_t const k : { 1, 2, 4 })
+    {
+      tournament_selection const tournament{k};
+      array<size_t,5> tcounts{};
+      for (size_t t{}; t != trials; ++t)
+        ++tcounts[tournament(distinct, urbg)];
+      double const n = static_cast<double>(distinct.size());
+      for (size_t i{}; i != distinct.size(); ++i)
+      {
+        double const r = static_cast<double>(distinct[i] / 10);
+        double const p =
+          (pow(n-r, static_cast<double>(k)) -
+            pow(n-r-1, static_cast<double>(k))) / pow(n, static_cast<double>(k));
+        tournament_ok = tournament_ok && near(tcounts[i], trials, p);
+      }
+    }
+
+    cout << roulette_ok << tournament_ok << '\n';
+  }
+
+  {
+    // Both plug into an evolver as its Selection...
+    static_assert(selection_strategy<roulette_selection, philox4x32>);
+    static_assert(selection_strategy<tournament_selection, philox4x32>);
+
+    string const target{ "To be or not to be." };
+    evolver_options options;
+    options.population_size = 300;
+    options.seed = 3400;
+
+    evolver<string, roulette_selection> ev1(target, options);
+    auto const start1 = ev1.stats().best_fitness;
+    ev1.run(stop_after_generations{100});
+
+    evolver<string, tournament_selection> ev2(
+      target, options, tournament_selection{4}
+    );
+    ev2.run(
+      [](evolver_stats const& s)
+        { return stop_at_fitness{0}(s) || stop_after_generations{2000}(s); }
+    );
+
+    cout << (ev1.stats().best_fitness < start1) << (ev2.best() == target)
+      << '\n';
+  }
+}
+
+//=============================================================================
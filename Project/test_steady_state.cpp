@@ -0,0 +1,110 @@
+//=============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "steady_state.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  string const target{ "To be or not to be." };
+  evolver_options options;
+  options.population_size = 100;
+  options.mutation_rate = 0.05;
+
+  {
+    // The initial population is that of an evolver with the same options
+    // and the target is reached with any number of workers...
+    evolver<string> ev(target, options);
+    for (size_t const threads : { 1, 3 })
+    {
+      options.threads = threads;
+      steady_state_evolver<string> ss(target, options);
+      bool const same_start =
+        ss.population() == ev.population() &&
+        ss.stats().best_fitness == ev.stats().best_fitness &&
+        ss.stats().generation == 0
+      ;
+      auto const s = ss.run(stop_at_fitness{0});
+      cout
+        << same_start
+        << (s.best_fitness == 0)
+        << (ss.best() == target)
+        << (s.evaluations >= options.population_size)
+      ;
+    }
+    cout << '\n';
+  }
+
+  {
+    // The first worker to be done stops all workers, the stored fitness
+    // values are correct, and the best fitness never gets worse...
+    options.threads = 3;
+    steady_state_options steady_state;
+    steady_state.selection_size = 3;
+    steady_state.replacement_size = 2;
+    steady_state_evolver<string> ss(target, options, steady_state);
+    size_t const initial_best = ss.stats().best_fitness;
+    auto const s = ss.run(stop_after_generations{5});
+
+    auto const population = ss.population();
+    auto const fitness = ss.fitness();
+    bool correct = true;
+    for (size_t i{}; i != population.size(); ++i)
+      correct = correct && fitness[i] == levenshtein(target, population[i]);
+    cout
+      << (s.generation >= 5)
+      << (s.evaluations <= 6*options.population_size + options.threads)
+      << correct
+      << (s.best_fitness <= initial_best)
+      << (s.best_fitness == ranges::min(fitness))
+      << (fitness[s.best_index] == s.best_fitness)
+      << '\n'
+    ;
+
+    // A second run continues from the first...
+    auto const s2 = ss.run(stop_after_generations{s.generation+2});
+    cout
+      << (s2.generation >= s.generation+2)
+      << (s2.best_fitness <= s.best_fitness)
+      << (s2.seconds >= s.seconds)
+      << '\n'
+    ;
+  }
+
+  {
+    // An exception thrown by a worker stops all workers and is rethrown...
+    struct throwing_fitness
+    {
+      size_t operator()(string const& a, string const& b) const
+      {
+        if (a == b)
+          throw runtime_error("found");
+        return levenshtein(a, b);
+      }
+    };
+    options.threads = 2;
+    steady_state_evolver<string, throwing_fitness> ss(target, options);
+    bool thrown = false;
+    try
+    {
+      ss.run(stop_at_fitness{0});
+    }
+    catch (runtime_error const&)
+    {
+      thrown = true;
+    }
+    cout << thrown << '\n';
+  }
+}
+
+//=============================================================================
@@ -0,0 +1,139 @@
+//=============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.hpp"
+#include "evolver.hpp"
+
+//=============================================================================
+
+int main()
+{
+  using namespace std;
+  using namespace uwindsor_2023w::comp3400::project;
+
+  {
+    thread_pool pool(4);
+    thread_pool serial(1);
+
+    // parallel_for() calls f once for every index...
+    vector<int> hits(10'007);
+    pool.parallel_for(0, hits.size(), 64,
+      [&](size_t const b, size_t const e)
+      {
+        for (size_t i = b; i != e; ++i)
+          ++hits[i];
+      }
+    );
+    vector<int> serial_hits(100);
+    serial.parallel_for(10, 90, 7,
+      [&](size_t const b, size_t const e)
+      {
+        for (size_t i = b; i != e; ++i)
+          ++serial_hits[i];
+      }
+    );
+
+    // The first exception thrown is rethrown...
+    bool caught = false;
+    try
+    {
+      pool.parallel_for(0, 1000, 10,
+        [](size_t const b, size_t)
+        {
+          if (b == 500)
+            throw runtime_error("500");
+        }
+      );
+    }
+    catch (runtime_error const& e)
+    {
+      caught = (e.what() == "500"s);
+    }
+
+    // The pool is reused across calls...
+    atomic<size_t> sum{};
+    for (int i{}; i != 100; ++i)
+      pool.parallel_for(0, 1000, 16,
+        [&](size_t const b, size_t const e)
+        {
+          for (size_t j = b; j != e; ++j)
+            sum += j;
+        }
+      );
+
+    auto f1 = pool.submit([]() { return 3400; });
+    auto f2 = serial.submit([]() { return "serial"s; });
+    cout
+      << (pool.concurrency() == 4)
+      << (serial.concurrency() == 1)
+      << ranges::all_of(hits, [](int const h) { return h == 1; })
+      << (accumulate(serial_hits.begin(), serial_hits.end(), 0) == 80)
+      << (serial_hits[9] == 0 && serial_hits[10] == 1 && serial_hits[90] == 0)
+      << caught
+      << (sum == 100*999*1000/2)
+      << (f1.get() == 3400)
+      << (f2.get() == "serial")
+      << '\n'
+    ;
+  }
+
+  {
+    // Tasks submitted concurrently from several threads all run (and idle
+    // workers are woken for each of them)...
+    atomic<size_t> ran{};
+    {
+      thread_pool pool(4);
+      vector<future<void>> futures[2];
+      auto const submitter =
+        [&](size_t const s)
+        {
+          for (size_t i{}; i != 5'000; ++i)
+            futures[s].push_back(pool.submit([&]() { ++ran; }));
+        }
+      ;
+      thread other(submitter, 1);
+      submitter(0);
+      other.join();
+      for (auto& fs : futures)
+        for (auto& f : fs)
+          f.get();
+
+      // ... including tasks submitted long after the workers went to sleep
+      // and tasks still queued when the pool is destroyed...
+      this_thread::sleep_for(chrono::milliseconds(20));
+      pool.submit([&]() { ++ran; }).get();
+      for (size_t i{}; i != 100; ++i)
+        pool.submit([&]() { ++ran; });
+    }
+    cout << (ran == 10'101) << '\n';
+  }
+
+  {
+    // An evolver with threads > 1 computes the same fitness values...
+    string const target{ "To be or not to be." };
+    evolver_options options;
+    options.population_size = 1000;
+    options.threads = 4;
+    options.evaluation_chunk = 50;
+    evolver<string> ev(target, options);
+    ev.run(stop_after_generations{10});
+
+    bool all_same = true;
+    for (size_t i{}; i != ev.population().size(); ++i)
+      all_same = all_same &&
+        ev.fitness()[i] == levenshtein(target, ev.population()[i]);
+    cout << all_same << (ev.stats().generation == 10) << '\n';
+  }
+}
+
+//=============================================================================
@@ -0,0 +1,320 @@
+#ifndef uwindsor_2023w_comp3400_project_thread_pool_hpp_
+#define uwindsor_2023w_comp3400_project_thread_pool_hpp_
+
+//=============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//=============================================================================
+
+namespace uwindsor_2023w {
+namespace comp3400 {
+namespace project {
+
+//=============================================================================
+
+//
+// thread_pool
+// class
+//
+// A fixed set of worker threads that live as long as the pool, i.e., threads
+// are created once and reused (e.g., across generations).
+//
+// Each worker has its own task deque: a worker pops tasks from the back of
+// its own deque and, when it is empty, steals from the front of the other
+// workers' deques. Idle workers sleep until a task is submitted. There is
+// no shared queue or lock: submitting a task locks only the deque it is
+// pushed to and popping or stealing a task locks only the deque it is taken
+// from (waking a sleeping worker uses an atomic counter).
+//
+// A thread_pool constructed with concurrency n has n-1 workers since the
+// calling thread also works in parallel_for(). With n == 1 there are no
+// workers and all work is done by the calling thread.
+//
+// NOTE: submit() and parallel_for() can be called from any thread but tasks
+//       must not block waiting for other tasks in the same pool.
+//
+class thread_pool
+{
+private:
+  struct worker_queue
+  {
+    std::mutex m;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // The shared state of one parallel_for() call. The range [0,n) is split
+  // into one slice per participant (the workers and the calling thread).
+  // Participants claim chunks from their own slice first and then steal
+  // chunks from the other slices.
+  struct parallel_for_job
+  {
+    struct slice
+    {
+      alignas(64) std::atomic<std::size_t> next;
+      std::size_t last;
+    };
+
+    std::function<void(std::size_t,std::size_t)> fn;
+    std::size_t chunk;
+    std::unique_ptr<slice[]> slices;
+    std::size_t nslices;
+    std::atomic<std::size_t> remaining;  // number of indices not yet done
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+
+    // Runs chunks starting with slice first_slice until no chunks remain...
+    void participate(std::size_t const first_slice) noexcept
+    {
+      for (std::size_t k{}; k != nslices; ++k)
+      {
+        slice& s = slices[(first_slice + k) % nslices];
+        for (;;)
+        {
+          std::size_t const b = s.next.fetch_add(chunk);
+          if (b >= s.last)
+            break;
+          std::size_t const e = std::min(b + chunk, s.last);
+          try
+          {
+            fn(b, e);
+          }
+          catch (...)
+          {
+            std::lock_guard lock(exception_mutex);
+            if (!exception)
+              exception = std::current_exception();
+          }
+          if (remaining.fetch_sub(e - b) == e - b)
+            remaining.notify_all();
+        }
+      }
+    }
+  };
+
+  std::vector<std::unique_ptr<worker_queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> next_queue_{};
+
+  // Sleeping: a worker that finds no task registers as a sleeper, reads
+  // epoch_, looks for a task once more, and then waits for epoch_ to change.
+  // push() increments epoch_ after queueing its task and only notifies if
+  // there are sleepers. (All of these are sequentially consistent so either
+  // the worker's second look finds the task or push() sees the sleeper and
+  // epoch_ has changed.)
+  std::atomic<std::uint32_t> epoch_{};
+  std::atomic<std::size_t> sleepers_{};
+  std::atomic<bool> stopping_{};
+
+  // Pops a task from queue i's back or steals one from another's front...
+  bool try_pop(std::size_t const i, std::function<void()>& task)
+  {
+    std::size_t const n = queues_.size();
+    for (std::size_t k{}; k != n; ++k)
+    {
+      worker_queue& q = *queues_[(i + k) % n];
+      std::lock_guard lock(q.m);
+      if (!q.tasks.empty())
+      {
+        if (k == 0)
+        {
+          task = std::move(q.tasks.back());
+          q.tasks.pop_back();
+        }
+        else
+        {
+          task = std::move(q.tasks.front());
+          q.tasks.pop_front();
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void worker_loop(std::size_t const i)
+  {
+    std::function<void()> task;
+    for (;;)
+    {
+      bool found = try_pop(i, task);
+      if (!found)
+      {
+        sleepers_.fetch_add(1);
+        std::uint32_t const epoch = epoch_.load();
+        found = try_pop(i, task);
+        bool const stop = !found && stopping_.load();
+        if (!found && !stop)
+          epoch_.wait(epoch);
+        sleepers_.fetch_sub(1);
+        if (stop)
+          return;
+      }
+      if (found)
+      {
+        task();
+        task = nullptr;
+      }
+    }
+  }
+
+  // Queues task on one worker's deque (round robin) and wakes a sleeper...
+  void push(std::function<void()> task)
+  {
+    std::size_t const i = next_queue_.fetch_add(1) % queues_.size();
+    {
+      std::lock_guard lock(queues_[i]->m);
+      queues_[i]->tasks.push_back(std::move(task));
+    }
+    epoch_.fetch_add(1);
+    if (sleepers_.load() != 0)
+      epoch_.notify_one();
+  }
+
+  void stop_and_join() noexcept
+  {
+    stopping_.store(true);
+    epoch_.fetch_add(1);
+    epoch_.notify_all();
+    for (auto& w : workers_)
+      w.join();
+  }
+
+public:
+  explicit thread_pool(
+    std::size_t const concurrency = std::thread::hardware_concurrency()
+  )
+  {
+    std::size_t const nworkers = concurrency > 1 ? concurrency-1 : 0;
+    for (std::size_t i{}; i != nworkers; ++i)
+      queues_.push_back(std::make_unique<worker_queue>());
+    try
+    {
+      workers_.reserve(nworkers);
+      for (std::size_t i{}; i != nworkers; ++i)
+        workers_.emplace_back([this,i]() { worker_loop(i); });
+    }
+    catch (...)
+    {
+      // NOTE: Destroying a joinable std::thread calls std::terminate()...
+      stop_and_join();
+      throw;
+    }
+  }
+
+  thread_pool(thread_pool const&) = delete;
+  thread_pool& operator=(thread_pool const&) = delete;
+
+  // Runs all submitted tasks and then joins the workers.
+  ~thread_pool()
+  {
+    stop_and_join();
+  }
+
+  // Returns the number of threads parallel_for() uses.
+  std::size_t concurrency() const noexcept { return workers_.size()+1; }
+
+  // Runs f() on a worker (or on the calling thread if there are no workers).
+  // Returns a std::future for f's result (or exception).
+  template <typename F>
+  requires std::invocable<F&>
+  auto submit(F&& f) -> std::future<std::invoke_result_t<F&>>
+  {
+    using result_type = std::invoke_result_t<F&>;
+    auto task = std::make_shared<std::packaged_task<result_type()>>(
+      std::forward<F>(f)
+    );
+    auto retval = task->get_future();
+    if (workers_.empty())
+      (*task)();
+    else
+      push([task]() { (*task)(); });
+    return retval;
+  }
+
+  //
+  // parallel_for(first, last, chunk, f)
+  //
+  // Calls f(b,e) for consecutive subranges [b,e) of [first,last) each having
+  // at most chunk indices. The subranges are computed in parallel by the
+  // workers and the calling thread. Returns when all subranges are done. If
+  // any call to f throws, the first exception is rethrown.
+  //
+  template <typename F>
+  requires std::invocable<F&, std::size_t, std::size_t>
+  void parallel_for(
+    std::size_t const first,
+    std::size_t const last,
+    std::size_t chunk,
+    F&& f
+  )
+  {
+    if (first >= last)
+      return;
+    chunk = std::max<std::size_t>(chunk, 1);
+    std::size_t const n = last - first;
+
+    // Without workers or with only one chunk, just do the work...
+    if (workers_.empty() || n <= chunk)
+    {
+      for (std::size_t b = first; b < last; b += chunk)
+        f(b, std::min(b + chunk, last));
+      return;
+    }
+
+    // Only use as many participants as there are chunks...
+    std::size_t const nchunks = (n + chunk - 1) / chunk;
+    std::size_t const nslices = std::min(concurrency(), nchunks);
+
+    auto job = std::make_shared<parallel_for_job>();
+    job->fn = [&f, first](std::size_t const b, std::size_t const e)
+      { f(first + b, first + e); };
+    job->chunk = chunk;
+    job->slices = std::make_unique<parallel_for_job::slice[]>(nslices);
+    job->nslices = nslices;
+    job->remaining.store(n);
+
+    // Each slice is a whole number of chunks...
+    for (std::size_t i{}; i != nslices; ++i)
+    {
+      job->slices[i].next.store(std::min(nchunks*i/nslices*chunk, n));
+      job->slices[i].last = std::min(nchunks*(i+1)/nslices*chunk, n);
+    }
+
+    for (std::size_t i{1}; i != nslices; ++i)
+      push([job,i]() { job->participate(i); });
+    job->participate(0);
+
+    // Wait for chunks stolen by workers to finish...
+    for (std::size_t r = job->remaining.load(); r != 0;
+      r = job->remaining.load())
+      job->remaining.wait(r);
+
+    if (job->exception)
+      std::rethrow_exception(job->exception);
+  }
+};
+
+//=============================================================================
+
+} // namespace project
+} // namespace comp3400
+} // namespace uwindsor_2023w
+
+//=============================================================================
+
+#endif // #ifndef uwindsor_2023w_comp3400_project_thread_pool_hpp_
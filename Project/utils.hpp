@@ -3,8 +3,12 @@
 
 //=============================================================================
 
+#include <array>
 #include <concepts>
+#include <cstddef>
 #include <iterator>
+#include <ranges>
+#include <span>
 #include <type_traits>
 
 //=============================================================================
@@ -68,6 +72,28 @@ concept insertable =
   }
 ;
 
+//
+// indel_editable<Container>
+// concept
+//
+// This concept is true if an element can be inserted into and erased from
+// Container at any position through an iterator (e.g., std::string,
+// std::vector, std::list, and gap_buffer), i.e., mutate_indel() can be used.
+//
+template <typename Container>
+concept indel_editable =
+  std::ranges::forward_range<Container> &&
+  requires (
+    Container c,
+    std::ranges::iterator_t<Container> i,
+    std::ranges::range_value_t<Container> const& v
+  )
+  {
+    { c.insert(i, v) } -> std::same_as<std::ranges::iterator_t<Container>>;
+    { c.erase(i) } -> std::same_as<std::ranges::iterator_t<Container>>;
+  }
+;
+
 //=============================================================================
 
 //
@@ -105,6 +131,34 @@ constexpr auto smart_inserter(Container& c)
 
 //=============================================================================
 
+//
+// fixed_extent_v<R>
+// variable template
+//
+// fixed_extent_v<R> is the number of elements of R if such is known at
+// compile-time (i.e., R is a C-style array, a std::array, or a fixed-extent
+// std::span), otherwise it is std::dynamic_extent.
+//
+template <typename R>
+inline constexpr std::size_t fixed_extent_v = std::dynamic_extent;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t fixed_extent_v<T[N]> = N;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t fixed_extent_v<std::array<T,N>> = N;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t fixed_extent_v<std::span<T,N>> = N;
+
+template <typename R>
+concept fixed_size_range =
+  std::ranges::range<R> &&
+  fixed_extent_v<std::remove_cvref_t<R>> != std::dynamic_extent
+;
+
+//=============================================================================
+
 } // namespace project
 } // namespace comp3400
 } // namespace uwindsor_2023w